@@ -0,0 +1,284 @@
+#include <ice/Memory.hpp>
+#include <ice/detail/Config.hpp>
+#include <ice/vm/Bytecode.hpp>
+#include <ice/vm/Interpreter.hpp>
+#include <ice/vm/Value.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	using ice::vm::Function;
+	using ice::vm::MakeInstruction;
+	using ice::vm::MakeInstructionBx;
+	using ice::vm::MakeInstructionSBx;
+	using ice::vm::MakeInstructionSC;
+	using ice::vm::NumericType;
+	using ice::vm::OpCode;
+	using ice::vm::Program;
+	using ice::vm::Register;
+	using ice::vm::Value;
+
+	struct Options final {
+		std::size_t Iterations = 10;
+		std::size_t Warmup = 2;
+		std::vector<std::string> Benchmarks;
+	};
+
+	struct Result final {
+		Register Value = 0;
+		std::vector<double> Samples;
+	};
+
+	using Native = Register(*)(Register);
+
+	Program BuildSum() {
+		Function sum("sum", 1, 1, 3);
+		sum.Emit(MakeInstructionSC(OpCode::JumpIfLessEqualI64, 0, 2, 2));
+		sum.Emit(MakeInstruction(OpCode::AddI64, 1, 1, 2));
+		sum.Emit(MakeInstructionSC(OpCode::LoopI64, 2, 0, -2));
+		sum.Emit(MakeInstruction(OpCode::Return, 1, 1));
+
+		Program program;
+		program.AddFunction(std::move(sum));
+		return program;
+	}
+	Register NativeSum(Register argument) {
+		const std::int64_t count = static_cast<std::int64_t>(argument);
+		std::int64_t sum = 0;
+		for (std::int64_t i = 0; i < count; ++i) {
+			sum += i;
+		}
+		return static_cast<Register>(sum);
+	}
+
+	Program BuildArithmetic() {
+		Function arithmetic("arithmetic", 1, 1, 5);
+		arithmetic.Emit(MakeInstructionBx(OpCode::LoadConstant, 3, arithmetic.AddConstant(0.999999)));
+		arithmetic.Emit(MakeInstructionBx(OpCode::LoadConstant, 4, arithmetic.AddConstant(1.0)));
+		arithmetic.Emit(MakeInstructionSC(OpCode::JumpIfLessEqualI64, 0, 1, 3));
+		arithmetic.Emit(MakeInstruction(OpCode::MulF64, 2, 2, 3));
+		arithmetic.Emit(MakeInstruction(OpCode::AddF64, 2, 2, 4));
+		arithmetic.Emit(MakeInstructionSC(OpCode::LoopI64, 1, 0, -3));
+		arithmetic.Emit(MakeInstruction(OpCode::Return, 2, 1));
+
+		Program program;
+		program.AddFunction(std::move(arithmetic));
+		return program;
+	}
+	Register NativeArithmetic(Register argument) {
+		const std::int64_t count = static_cast<std::int64_t>(argument);
+		volatile double factor = 0.999999;
+		double value = 0.0;
+		for (std::int64_t i = 0; i < count; ++i) {
+			value = value * factor + 1.0;
+		}
+
+		Register result;
+		std::memcpy(&result, &value, sizeof(result));
+		return result;
+	}
+
+	Program BuildFibonacci() {
+		Function fibonacci("fibonacci", 1, 1, 4);
+		fibonacci.Emit(MakeInstructionSBx(OpCode::LoadImmediate, 1, 2));
+		fibonacci.Emit(MakeInstructionSC(OpCode::JumpIfLessI64, 0, 1, 6));
+		fibonacci.Emit(MakeInstructionSC(OpCode::AddImmediateI64, 2, 0, -1));
+		fibonacci.Emit(MakeInstruction(OpCode::Call, 2, 0, 1));
+		fibonacci.Emit(MakeInstructionSC(OpCode::AddImmediateI64, 3, 0, -2));
+		fibonacci.Emit(MakeInstruction(OpCode::Call, 3, 0, 1));
+		fibonacci.Emit(MakeInstruction(OpCode::AddI64, 0, 2, 3));
+		fibonacci.Emit(MakeInstruction(OpCode::Return, 0, 1));
+		fibonacci.Emit(MakeInstruction(OpCode::Return, 0, 1));
+
+		Program program;
+		program.AddFunction(std::move(fibonacci));
+		return program;
+	}
+	Register NativeFibonacci(Register argument) {
+		return argument < 2 ? argument : NativeFibonacci(argument - 1) + NativeFibonacci(argument - 2);
+	}
+
+	Program BuildNested() {
+		Function nested("nested", 1, 1, 7);
+		nested.Emit(MakeInstructionSBx(OpCode::LoadImmediate, 4, 7));
+		nested.Emit(MakeInstructionSC(OpCode::JumpIfLessEqualI64, 0, 1, 7));
+		nested.Emit(MakeInstructionSBx(OpCode::LoadImmediate, 2, 0));
+		nested.Emit(MakeInstruction(OpCode::MulI64, 3, 1, 2));
+		nested.Emit(MakeInstruction(OpCode::ModI64, 3, 3, 4));
+		nested.Emit(MakeInstructionSC(OpCode::JumpIfNotEqualI64, 3, 6, 1));
+		nested.Emit(MakeInstructionSC(OpCode::AddImmediateI64, 5, 5, 1));
+		nested.Emit(MakeInstructionSC(OpCode::LoopI64, 2, 0, -5));
+		nested.Emit(MakeInstructionSC(OpCode::LoopI64, 1, 0, -7));
+		nested.Emit(MakeInstruction(OpCode::Return, 5, 1));
+
+		Program program;
+		program.AddFunction(std::move(nested));
+		return program;
+	}
+	Register NativeNested(Register argument) {
+		const std::int64_t count = static_cast<std::int64_t>(argument);
+		volatile std::int64_t divisor = 7;
+		std::int64_t result = 0;
+		for (std::int64_t i = 0; i < count; ++i) {
+			for (std::int64_t j = 0; j < count; ++j) {
+				result += i * j % divisor == 0;
+			}
+		}
+		return static_cast<Register>(result);
+	}
+
+	Program BuildDynamicSum() {
+		Function sum("dynamic-sum", 1, 1, 4);
+		sum.Emit(MakeInstruction(OpCode::BoxValue, 0, 0, static_cast<std::uint16_t>(NumericType::Int64)));
+		sum.Emit(MakeInstructionBx(OpCode::LoadConstant, 1, sum.AddConstant(Value::FromInt(0))));
+		sum.Emit(MakeInstructionBx(OpCode::LoadConstant, 2, sum.AddConstant(Value::FromInt(0))));
+		sum.Emit(MakeInstructionBx(OpCode::LoadConstant, 3, sum.AddConstant(Value::FromInt(1))));
+		sum.Emit(MakeInstructionSC(OpCode::JumpIfLessEqualValue, 0, 2, 3));
+		sum.Emit(MakeInstruction(OpCode::AddValue, 1, 1, 2));
+		sum.Emit(MakeInstruction(OpCode::AddValue, 2, 2, 3));
+		sum.Emit(MakeInstructionSC(OpCode::JumpIfLessValue, 2, 0, -3));
+		sum.Emit(MakeInstruction(OpCode::Return, 1, 1));
+
+		Program program;
+		program.AddFunction(std::move(sum));
+		return program;
+	}
+	Register NativeDynamicSum(Register argument) {
+		return Value::FromInteger(static_cast<std::int64_t>(NativeSum(argument))).Bits();
+	}
+
+	struct Benchmark final {
+		std::string_view Name;
+		Program(*Build)();
+		Native Run;
+		Register Argument;
+	};
+
+	const Benchmark s_Benchmarks[] = {
+		{ "sum", BuildSum, NativeSum, 10'000'000 },
+		{ "arithmetic", BuildArithmetic, NativeArithmetic, 10'000'000 },
+		{ "fibonacci", BuildFibonacci, NativeFibonacci, 27 },
+		{ "nested", BuildNested, NativeNested, 2'000 },
+		{ "dynamic-sum", BuildDynamicSum, NativeDynamicSum, 10'000'000 },
+	};
+
+	bool ParseNumber(std::string_view argument, std::size_t& number) {
+		if (argument.empty()) return false;
+
+		std::size_t result = 0;
+		for (char c : argument) {
+			if (c < '0' || c > '9') return false;
+			result = result * 10 + (c - '0');
+		}
+		number = result;
+		return true;
+	}
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view argument = argv[i];
+			std::size_t number = 0;
+			if (argument == "--benchmark" && i + 1 < argc) {
+				options.Benchmarks.push_back(argv[++i]);
+			} else if (argument == "--iterations" && i + 1 < argc && ParseNumber(argv[++i], number) && number > 0) {
+				options.Iterations = number;
+			} else if (argument == "--warmup" && i + 1 < argc && ParseNumber(argv[++i], number)) {
+				options.Warmup = number;
+			} else {
+				std::cerr << "usage: " << argv[0] << " [--benchmark <name>]... [--iterations <count>] [--warmup <count>]\n";
+				return false;
+			}
+		}
+		return true;
+	}
+	bool IsSelected(const Options& options, std::string_view name) {
+		return options.Benchmarks.empty() || std::find(options.Benchmarks.begin(), options.Benchmarks.end(), name) != options.Benchmarks.end();
+	}
+
+	template<typename F>
+	Result Run(const Options& options, F&& run) {
+		Result result;
+		result.Samples.reserve(options.Iterations);
+
+		for (std::size_t i = 0; i < options.Warmup; ++i) {
+			run();
+		}
+		for (std::size_t i = 0; i < options.Iterations; ++i) {
+			const auto begin = std::chrono::steady_clock::now();
+			result.Value = run();
+			const auto end = std::chrono::steady_clock::now();
+			result.Samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+		}
+		std::sort(result.Samples.begin(), result.Samples.end());
+		return result;
+	}
+
+	double Percentile(const std::vector<double>& samples, double percentile) {
+		const std::size_t index = static_cast<std::size_t>(percentile / 100.0 * (samples.size() - 1) + 0.5);
+		return samples[index];
+	}
+	void PrintResult(const Benchmark& benchmark, const Options& options, const Result& interpreted, const Result& native) {
+#ifdef ISCOMPUTEDGOTO
+		constexpr std::string_view dispatch = "computed-goto";
+#else
+		constexpr std::string_view dispatch = "switch";
+#endif
+		const double median = Percentile(interpreted.Samples, 50.0);
+		const double nativeMedian = Percentile(native.Samples, 50.0);
+
+		std::cout << "{\"benchmark\":\"" << benchmark.Name
+				  << "\",\"dispatch\":\"" << dispatch
+				  << "\",\"argument\":" << benchmark.Argument
+				  << ",\"result\":" << interpreted.Value
+				  << ",\"matches_native\":" << (interpreted.Value == native.Value ? "true" : "false")
+				  << ",\"iterations\":" << options.Iterations
+				  << ",\"ns_min\":" << interpreted.Samples.front()
+				  << ",\"ns_p50\":" << median
+				  << ",\"ns_p90\":" << Percentile(interpreted.Samples, 90.0)
+				  << ",\"ns_max\":" << interpreted.Samples.back()
+				  << ",\"native_ns_p50\":" << nativeMedian
+				  << ",\"slowdown\":" << (nativeMedian > 0.0 ? median / nativeMedian : 0.0)
+				  << "}\n";
+	}
+}
+
+int main(int argc, char* argv[]) {
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 2;
+
+	ice::vm::Interpreter interpreter;
+	for (const Benchmark& benchmark : s_Benchmarks) {
+		if (!IsSelected(options, benchmark.Name)) continue;
+
+		const Program program = benchmark.Build();
+		std::string error;
+		if (!program.Verify(&error)) {
+			std::cerr << "error: " << error << '\n';
+			return 1;
+		}
+
+		ice::vm::ExecutionStatus status = ice::vm::ExecutionStatus::Success;
+		const Result interpreted = Run(options, [&] {
+			Register result = 0;
+			status = interpreter.Run(program, 0, ice::Span<const Register>(&benchmark.Argument, 1), ice::Span<Register>(&result, 1));
+			return result;
+		});
+		if (status != ice::vm::ExecutionStatus::Success) {
+			std::cerr << "error: " << benchmark.Name << ": " << ice::vm::GetExecutionStatusName(status) << '\n';
+			return 1;
+		}
+
+		const Result native = Run(options, [&] {
+			return benchmark.Run(benchmark.Argument);
+		});
+		PrintResult(benchmark, options, interpreted, native);
+	}
+	return 0;
+}
\ No newline at end of file
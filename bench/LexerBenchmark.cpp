@@ -0,0 +1,433 @@
+#include <ice/File.hpp>
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	std::atomic<std::size_t> s_AllocationCount(0);
+}
+
+void* operator new(std::size_t size) {
+	s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* const pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+	else throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+	return operator new(size);
+}
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+void operator delete[](void* pointer) noexcept {
+	std::free(pointer);
+}
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+void operator delete[](void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+namespace {
+	using ice::GetTokenTypeWord;
+	using ice::TokenType;
+
+	constexpr std::string_view s_CJKWords[] = {
+		u8"변수", u8"함수", u8"반환값", u8"한국어", u8"문자열", u8"変数", u8"関数", u8"文字列", u8"値", u8"名前", u8"数据", u8"结果",
+	};
+
+	struct Options final {
+		std::size_t Size = 4 * 1024 * 1024;
+		std::size_t Iterations = 20;
+		std::size_t Warmup = 3;
+		std::uint32_t Seed = 42;
+		std::vector<std::string> Corpora;
+		std::vector<std::string> Paths;
+	};
+
+	struct Corpus final {
+		std::string Name;
+		std::string Source;
+		ice::MappedFile File;
+
+		std::string_view Data() const noexcept {
+			return File.IsOpen() ? File.Data() : std::string_view(Source);
+		}
+	};
+
+	struct Sample final {
+		std::size_t Tokens = 0;
+		std::size_t Allocations = 0;
+		std::chrono::steady_clock::time_point BeginTime;
+		std::chrono::steady_clock::time_point EndTime;
+
+		void Begin() noexcept {
+			Allocations = s_AllocationCount.load(std::memory_order_relaxed);
+			BeginTime = std::chrono::steady_clock::now();
+		}
+		void End() noexcept {
+			EndTime = std::chrono::steady_clock::now();
+			Allocations = s_AllocationCount.load(std::memory_order_relaxed) - Allocations;
+		}
+	};
+
+	struct Result final {
+		std::size_t Tokens = 0;
+		std::size_t Allocations = 0;
+		std::vector<double> Samples;
+	};
+
+	using Generator = std::string(*)(std::mt19937&, std::size_t);
+
+	std::size_t Random(std::mt19937& random, std::size_t count) {
+		return std::uniform_int_distribution<std::size_t>(0, count - 1)(random);
+	}
+	std::string_view RandomKeyword(std::mt19937& random) {
+		const std::size_t begin = static_cast<std::size_t>(TokenType::ModuleKeyword);
+		const std::size_t end = static_cast<std::size_t>(TokenType::TypeOfKeyword) + 1;
+		return GetTokenTypeWord(static_cast<TokenType>(begin + Random(random, end - begin)));
+	}
+	std::string_view RandomOperator(std::mt19937& random) {
+		const std::size_t begin = static_cast<std::size_t>(TokenType::Plus);
+		const std::size_t end = static_cast<std::size_t>(TokenType::Question) + 1;
+		return GetTokenTypeWord(static_cast<TokenType>(begin + Random(random, end - begin)));
+	}
+	void AppendIdentifier(std::mt19937& random, std::string& source) {
+		static constexpr std::string_view firsts = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+		static constexpr std::string_view others = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+
+		const std::size_t length = 1 + Random(random, 24);
+		source += firsts[Random(random, firsts.size())];
+		for (std::size_t i = 1; i < length; ++i) {
+			source += others[Random(random, others.size())];
+		}
+	}
+	void AppendDigits(std::mt19937& random, std::string& source, std::string_view digits) {
+		const std::size_t groups = 1 + Random(random, 4);
+		for (std::size_t i = 0; i < groups; ++i) {
+			if (i != 0) {
+				source += '\'';
+			}
+			const std::size_t length = 1 + Random(random, 4);
+			for (std::size_t j = 0; j < length; ++j) {
+				source += digits[Random(random, digits.size())];
+			}
+		}
+	}
+
+	std::string GenerateIdentifiers(std::mt19937& random, std::size_t size) {
+		std::string source;
+		while (source.size() < size) {
+			const std::size_t count = 4 + Random(random, 8);
+			for (std::size_t i = 0; i < count; ++i) {
+				if (Random(random, 4) == 0) {
+					source += RandomKeyword(random);
+				} else {
+					AppendIdentifier(random, source);
+				}
+				source += Random(random, 6) == 0 ? '.' : ' ';
+			}
+			source += '\n';
+		}
+		return source;
+	}
+	std::string GenerateOperators(std::mt19937& random, std::size_t size) {
+		std::string source;
+		while (source.size() < size) {
+			const std::size_t count = 8 + Random(random, 16);
+			for (std::size_t i = 0; i < count; ++i) {
+				source += RandomOperator(random);
+				source += ' ';
+			}
+			source += '\n';
+		}
+		return source;
+	}
+	std::string GenerateNumbers(std::mt19937& random, std::size_t size) {
+		std::string source;
+		while (source.size() < size) {
+			const std::size_t count = 4 + Random(random, 8);
+			for (std::size_t i = 0; i < count; ++i) {
+				switch (Random(random, 5)) {
+				case 0:
+					source += "0b";
+					AppendDigits(random, source, "01");
+					break;
+
+				case 1:
+					source += '0';
+					AppendDigits(random, source, "01234567");
+					break;
+
+				case 2:
+					source += "0x";
+					AppendDigits(random, source, "0123456789abcdefABCDEF");
+					break;
+
+				case 3:
+					source += static_cast<char>('1' + Random(random, 9));
+					AppendDigits(random, source, "0123456789");
+					break;
+
+				case 4:
+					source += static_cast<char>('1' + Random(random, 9));
+					AppendDigits(random, source, "0123456789");
+					source += '.';
+					AppendDigits(random, source, "0123456789");
+					if (Random(random, 2) == 0) {
+						source += Random(random, 2) == 0 ? "e+" : "E-";
+						AppendDigits(random, source, "0123456789");
+					}
+					break;
+				}
+				source += ", ";
+			}
+			source += '\n';
+		}
+		return source;
+	}
+	std::string GenerateStrings(std::mt19937& random, std::size_t size) {
+		static constexpr std::string_view characters = "abcdefghijklmnopqrstuvwxyz0123456789 +-*/(){}[].,;:";
+		static constexpr std::string_view escapes[] = { "\\\"", "\\n", "\\t", "\\0" };
+
+		std::string source;
+		while (source.size() < size) {
+			if (Random(random, 4) == 0) {
+				source += '\'';
+				source += characters[Random(random, characters.size() - 1)];
+				source += "' ";
+			} else {
+				source += '"';
+				const std::size_t length = Random(random, 64);
+				for (std::size_t i = 0; i < length; ++i) {
+					if (Random(random, 16) == 0) {
+						source += escapes[Random(random, std::size(escapes))];
+					} else {
+						source += characters[Random(random, characters.size())];
+					}
+				}
+				source += "\" ";
+			}
+			if (Random(random, 4) == 0) {
+				source += '\n';
+			}
+		}
+		return source;
+	}
+	std::string GenerateCJK(std::mt19937& random, std::size_t size) {
+		std::string source;
+		while (source.size() < size) {
+			const std::size_t count = 4 + Random(random, 8);
+			for (std::size_t i = 0; i < count; ++i) {
+				switch (Random(random, 4)) {
+				case 0:
+					source += '"';
+					source += s_CJKWords[Random(random, std::size(s_CJKWords))];
+					source += s_CJKWords[Random(random, std::size(s_CJKWords))];
+					source += '"';
+					break;
+
+				case 1:
+					source += RandomKeyword(random);
+					break;
+
+				default:
+					source += s_CJKWords[Random(random, std::size(s_CJKWords))];
+					if (Random(random, 2) == 0) {
+						source += '_';
+						source += s_CJKWords[Random(random, std::size(s_CJKWords))];
+					}
+					break;
+				}
+				source += ' ';
+			}
+			source += '\n';
+		}
+		return source;
+	}
+	std::string GenerateErrors(std::mt19937& random, std::size_t size) {
+		static constexpr std::string_view errors[] = { "@", "#", "$", "\\", "0b102", "0x", "1'", "1''0", "1.e5", "09", "\x01", "\"unterminated" };
+
+		std::string source;
+		while (source.size() < size) {
+			const std::size_t count = 4 + Random(random, 8);
+			for (std::size_t i = 0; i < count; ++i) {
+				if (Random(random, 3) == 0) {
+					source += errors[Random(random, std::size(errors))];
+				} else {
+					AppendIdentifier(random, source);
+				}
+				source += ' ';
+			}
+			source += '\n';
+		}
+		return source;
+	}
+
+	struct GeneratedCorpus final {
+		std::string_view Name;
+		Generator Generate;
+	};
+
+	constexpr GeneratedCorpus s_GeneratedCorpora[] = {
+		{ "identifier", GenerateIdentifiers },
+		{ "operator", GenerateOperators },
+		{ "number", GenerateNumbers },
+		{ "string", GenerateStrings },
+		{ "cjk", GenerateCJK },
+		{ "error", GenerateErrors },
+	};
+
+	bool ParseNumber(std::string_view argument, std::size_t& number) {
+		if (argument.empty()) return false;
+
+		std::size_t result = 0;
+		for (char c : argument) {
+			if (c < '0' || c > '9') return false;
+			result = result * 10 + (c - '0');
+		}
+		number = result;
+		return true;
+	}
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view argument = argv[i];
+			std::size_t number = 0;
+			if (argument == "--corpus" && i + 1 < argc) {
+				options.Corpora.push_back(argv[++i]);
+			} else if (argument == "--size" && i + 1 < argc && ParseNumber(argv[++i], number) && number > 0) {
+				options.Size = number;
+			} else if (argument == "--iterations" && i + 1 < argc && ParseNumber(argv[++i], number) && number > 0) {
+				options.Iterations = number;
+			} else if (argument == "--warmup" && i + 1 < argc && ParseNumber(argv[++i], number)) {
+				options.Warmup = number;
+			} else if (argument == "--seed" && i + 1 < argc && ParseNumber(argv[++i], number)) {
+				options.Seed = static_cast<std::uint32_t>(number);
+			} else if (argument.size() > 2 && argument.substr(0, 2) == "--") {
+				std::cerr << "usage: " << argv[0] << " [--corpus <name>]... [--size <bytes>] [--iterations <count>] [--warmup <count>] [--seed <seed>] [file]...\n";
+				return false;
+			} else {
+				options.Paths.push_back(argv[i]);
+			}
+		}
+		return true;
+	}
+	bool IsSelected(const Options& options, std::string_view name) {
+		return options.Corpora.empty() || std::find(options.Corpora.begin(), options.Corpora.end(), name) != options.Corpora.end();
+	}
+
+	template<typename F>
+	Result Run(const Options& options, F&& lex) {
+		Result result;
+		result.Samples.reserve(options.Iterations);
+
+		for (std::size_t i = 0; i < options.Warmup; ++i) {
+			Sample sample;
+			lex(sample);
+		}
+		for (std::size_t i = 0; i < options.Iterations; ++i) {
+			Sample sample;
+			lex(sample);
+			result.Tokens = sample.Tokens;
+			result.Allocations += sample.Allocations;
+			result.Samples.push_back(std::chrono::duration<double, std::nano>(sample.EndTime - sample.BeginTime).count());
+		}
+		return result;
+	}
+
+	double Percentile(const std::vector<double>& samples, double percentile) {
+		const std::size_t index = static_cast<std::size_t>(percentile / 100.0 * (samples.size() - 1) + 0.5);
+		return samples[index];
+	}
+	void PrintResult(std::string_view benchmark, std::string_view corpus, std::size_t bytes, const Options& options, Result& result) {
+		std::sort(result.Samples.begin(), result.Samples.end());
+		const double median = Percentile(result.Samples, 50.0);
+		const double seconds = median / 1e9;
+
+		std::cout << "{\"benchmark\":\"" << benchmark << "\",\"corpus\":\"";
+		for (char c : corpus) {
+			if (c == '"' || c == '\\') {
+				std::cout << '\\';
+			}
+			std::cout << c;
+		}
+		std::cout << "\",\"bytes\":" << bytes
+				  << ",\"tokens\":" << result.Tokens
+				  << ",\"iterations\":" << options.Iterations
+				  << ",\"mb_per_s\":" << (seconds > 0.0 ? bytes / seconds / 1e6 : 0.0)
+				  << ",\"tokens_per_s\":" << (seconds > 0.0 ? result.Tokens / seconds : 0.0)
+				  << ",\"allocations_per_token\":" << (result.Tokens ? static_cast<double>(result.Allocations) / options.Iterations / result.Tokens : 0.0)
+				  << ",\"ns_min\":" << result.Samples.front()
+				  << ",\"ns_p50\":" << median
+				  << ",\"ns_p90\":" << Percentile(result.Samples, 90.0)
+				  << ",\"ns_p99\":" << Percentile(result.Samples, 99.0)
+				  << ",\"ns_max\":" << result.Samples.back()
+				  << "}\n";
+	}
+
+	void Benchmark(const Corpus& corpus, const Options& options) {
+		const std::string_view source = corpus.Data();
+
+		Result lex = Run(options, [&](Sample& sample) {
+			ice::Lexer lexer;
+			ice::Messages messages;
+			sample.Begin();
+			lexer.Lex(corpus.Name, source, messages);
+			sample.End();
+			sample.Tokens = lexer.Tokens().Size();
+		});
+		PrintResult("lex", corpus.Name, source.size(), options, lex);
+
+		Result intern = Run(options, [&](Sample& sample) {
+			ice::Interner interner;
+			ice::Lexer lexer(interner);
+			ice::Messages messages;
+			sample.Begin();
+			lexer.Lex(corpus.Name, source, messages);
+			sample.End();
+			sample.Tokens = lexer.Tokens().Size();
+		});
+		PrintResult("lex-intern", corpus.Name, source.size(), options, intern);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 2;
+
+	std::vector<Corpus> corpora;
+	for (const GeneratedCorpus& generatedCorpus : s_GeneratedCorpora) {
+		if (!IsSelected(options, generatedCorpus.Name)) continue;
+
+		std::mt19937 random(options.Seed);
+		Corpus& corpus = corpora.emplace_back();
+		corpus.Name = generatedCorpus.Name;
+		corpus.Source = generatedCorpus.Generate(random, options.Size);
+	}
+	for (const std::string& path : options.Paths) {
+		Corpus& corpus = corpora.emplace_back();
+		corpus.Name = path;
+		if (!corpus.File.Open(path)) {
+			std::cerr << "error: cannot open '" << path << "'\n";
+			return 1;
+		}
+	}
+
+	for (const Corpus& corpus : corpora) {
+		Benchmark(corpus, options);
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/ast/Tree.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ice {
+	class CompilationCache final {
+	public:
+		static constexpr std::uint32_t FormatVersion = 1;
+
+	private:
+		std::string m_Directory;
+
+	public:
+		CompilationCache() = default;
+		explicit CompilationCache(std::string directory) noexcept;
+		CompilationCache(const CompilationCache& cache);
+		CompilationCache(CompilationCache&& cache) noexcept;
+		~CompilationCache() = default;
+
+	public:
+		CompilationCache& operator=(const CompilationCache& cache);
+		CompilationCache& operator=(CompilationCache&& cache) noexcept;
+
+	public:
+		const std::string& Directory() const noexcept;
+		void Directory(std::string newDirectory) noexcept;
+
+		static std::uint64_t Key(std::string_view source) noexcept;
+		std::string Path(const std::string& sourcePath, std::uint64_t key) const;
+		bool Load(const std::string& sourcePath, std::string_view source, Interner& interner, TokenBuffer& tokens, ast::Tree& tree) const;
+		bool Store(const std::string& sourcePath, std::string_view source, const Interner& interner, const TokenBuffer& tokens,
+				   const ast::Tree& tree) const;
+	};
+}
\ No newline at end of file
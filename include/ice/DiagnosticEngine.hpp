@@ -0,0 +1,38 @@
+#pragma once
+
+#include <ice/DiagnosticSink.hpp>
+#include <ice/Message.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace ice {
+	class DiagnosticEngine final {
+	private:
+		std::mutex m_Mutex;
+		std::deque<Messages> m_Buffers;
+		std::atomic<std::size_t> m_ErrorCount = 0,
+								 m_WarningCount = 0;
+
+	public:
+		DiagnosticEngine() noexcept = default;
+		DiagnosticEngine(const DiagnosticEngine&) = delete;
+		~DiagnosticEngine() = default;
+
+	public:
+		DiagnosticEngine& operator=(const DiagnosticEngine&) = delete;
+
+	public:
+		void Clear() noexcept;
+		bool HasErrors() const noexcept;
+		std::size_t ErrorCount() const noexcept;
+		std::size_t WarningCount() const noexcept;
+		void Count(MessageType type, std::size_t count = 1) noexcept;
+
+		Messages& Open();
+		Messages Collect();
+		void Print(DiagnosticSink& sink);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace ice {
+	class Message;
+	class Messages;
+
+	class DiagnosticSink {
+	public:
+		DiagnosticSink() noexcept = default;
+		DiagnosticSink(const DiagnosticSink&) = delete;
+		virtual ~DiagnosticSink() = default;
+
+	public:
+		DiagnosticSink& operator=(const DiagnosticSink&) = delete;
+
+	public:
+		virtual void Write(const Messages& messages, const Message& message) = 0;
+		virtual void Flush();
+	};
+
+	class TerminalDiagnosticSink final : public DiagnosticSink {
+	private:
+		std::ostream* m_Stream = nullptr;
+		std::string m_Buffer;
+		std::size_t m_BufferSize = 0;
+		bool m_IsFirst = true;
+
+	public:
+		explicit TerminalDiagnosticSink(std::ostream& stream, std::size_t bufferSize = 64 * 1024);
+		virtual ~TerminalDiagnosticSink() override;
+
+	public:
+		virtual void Write(const Messages& messages, const Message& message) override;
+		virtual void Flush() override;
+	};
+
+	class JsonDiagnosticSink final : public DiagnosticSink {
+	private:
+		std::ostream* m_Stream = nullptr;
+		std::string m_Buffer;
+		std::string m_Description;
+		std::size_t m_BufferSize = 0;
+
+	public:
+		explicit JsonDiagnosticSink(std::ostream& stream, std::size_t bufferSize = 64 * 1024);
+		virtual ~JsonDiagnosticSink() override;
+
+	public:
+		virtual void Write(const Messages& messages, const Message& message) override;
+		virtual void Flush() override;
+	};
+
+	class CountingDiagnosticSink final : public DiagnosticSink {
+	private:
+		std::size_t m_NoteCount = 0,
+					m_WarningCount = 0,
+					m_ErrorCount = 0;
+
+	public:
+		CountingDiagnosticSink() noexcept = default;
+		virtual ~CountingDiagnosticSink() override = default;
+
+	public:
+		virtual void Write(const Messages& messages, const Message& message) override;
+
+	public:
+		void Clear() noexcept;
+		std::size_t Count() const noexcept;
+		std::size_t NoteCount() const noexcept;
+		std::size_t WarningCount() const noexcept;
+		std::size_t ErrorCount() const noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ice {
+	class Document final {
+	public:
+		static constexpr std::size_t BlockSize = 4 * 1024;
+
+	private:
+		struct Block final {
+			std::string Text;
+			std::size_t LineCount = 0;
+			TokenBuffer Tokens;
+			Messages Diagnostics;
+		};
+
+	private:
+		std::string m_SourceName;
+		Interner* m_Interner = nullptr;
+		std::vector<Block> m_Blocks;
+
+	public:
+		Document() noexcept = default;
+		Document(std::string sourceName, Interner& interner) noexcept;
+		Document(const Document& document);
+		Document(Document&& document) noexcept;
+		~Document() = default;
+
+	public:
+		Document& operator=(const Document& document);
+		Document& operator=(Document&& document) noexcept;
+
+	public:
+		void Clear() noexcept;
+		bool IsEmpty() const noexcept;
+		const std::string& SourceName() const noexcept;
+		std::size_t Size() const noexcept;
+		std::size_t LineCount() const noexcept;
+		std::size_t BlockCount() const noexcept;
+		bool HasErrors() const noexcept;
+
+		bool Assign(std::string_view source);
+		bool Replace(std::size_t begin, std::size_t end, std::string_view replacement);
+		std::string Text() const;
+		TokenBuffer Tokens(std::string_view text) const;
+		Messages Diagnostics() const;
+
+	private:
+		bool Insert(std::size_t begin, std::size_t end, std::string_view text);
+		bool Lex(Block& block, bool isLast);
+	};
+}
\ No newline at end of file
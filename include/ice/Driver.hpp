@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ice/Cache.hpp>
+#include <ice/DiagnosticEngine.hpp>
+#include <ice/File.hpp>
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+#include <ice/ThreadPool.hpp>
+#include <ice/ast/Tree.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ice {
+	inline constexpr std::size_t NoModule = static_cast<std::size_t>(-1);
+
+	struct Import final {
+		std::string Name;
+		std::uint32_t Token = ast::NoTokenIndex;
+		std::uint32_t TokenCount = 0;
+		std::size_t Module = NoModule;
+	};
+
+	struct Module final {
+		std::string Path;
+		std::string Name;
+		std::uint32_t NameToken = ast::NoTokenIndex;
+		std::uint32_t NameTokenCount = 0;
+		std::vector<Import> Imports;
+		std::vector<std::size_t> Dependents;
+		std::atomic<std::size_t> PendingImports = 0;
+
+		MappedFile File;
+		ice::Interner Interner;
+		TokenBuffer Tokens;
+		ast::Tree Tree;
+		ice::Messages* Messages = nullptr;
+
+		bool IsOpened = false;
+		bool IsCached = false;
+		bool IsCompiled = false;
+		bool IsSucceeded = false;
+		double Seconds = 0.0;
+	};
+
+	class Driver final {
+	private:
+		std::deque<Module> m_Modules;
+		std::unordered_map<std::string_view, std::size_t> m_ModuleNames;
+		std::size_t m_JobCount = 1;
+		const CompilationCache* m_Cache = nullptr;
+
+	public:
+		explicit Driver(std::size_t jobCount) noexcept;
+		Driver(const Driver&) = delete;
+		~Driver() = default;
+
+	public:
+		Driver& operator=(const Driver&) = delete;
+		const Module& operator[](std::size_t index) const noexcept;
+
+	public:
+		std::size_t Size() const noexcept;
+		std::size_t JobCount() const noexcept;
+		const CompilationCache* Cache() const noexcept;
+		void Cache(const CompilationCache* newCache) noexcept;
+
+		void Add(std::string path);
+		bool Build(DiagnosticEngine& engine);
+
+	private:
+		void Scan(ThreadPool& pool, Module& module);
+		void Link();
+		void Compile(ThreadPool& pool, std::size_t index);
+		void Compile(Module& module);
+		void ReportCycles();
+
+		template<DiagnosticId Id>
+		void AddError(Module& module, std::uint32_t token, std::uint32_t tokenCount);
+		template<DiagnosticId Id>
+		void AddError(Module& module, std::string_view argument);
+	};
+}
\ No newline at end of file
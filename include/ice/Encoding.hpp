@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <string_view>
+
 namespace ice {
 	int GetCodepointLength(char firstByte) noexcept;
 	bool IsDigit(char firstByte) noexcept;
@@ -8,6 +11,10 @@ namespace ice {
 
 	bool IsFullWidth(char32_t character) noexcept;
 	bool IsHalfWidth(char32_t character) noexcept;
+	std::size_t DisplayWidth(std::string_view string) noexcept;
+
+	int GetValidCodepointLength(std::string_view source, std::size_t begin) noexcept;
+	int GetInvalidSequenceLength(std::string_view source, std::size_t begin) noexcept;
 
 	char32_t GetCodepoint(const char* begin, int length) noexcept;
 }
\ No newline at end of file
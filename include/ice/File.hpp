@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace ice {
+	class MappedFile final {
+	private:
+		const char* m_Data = nullptr;
+		std::size_t m_Size = 0;
+#ifdef _WIN32
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#endif
+
+	public:
+		MappedFile() noexcept = default;
+		MappedFile(MappedFile&& file) noexcept;
+		~MappedFile();
+
+	public:
+		MappedFile& operator=(MappedFile&& file) noexcept;
+
+	public:
+		bool Open(const std::string& path);
+		void Close() noexcept;
+		bool IsOpen() const noexcept;
+		std::string_view Data() const noexcept;
+	};
+}
\ No newline at end of file
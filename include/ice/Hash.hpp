@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ice {
+	std::uint64_t Hash64(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept;
+	std::uint64_t Hash64(std::string_view data, std::uint64_t seed = 0) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ice/Memory.hpp>
+#include <ice/TokenType.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ice {
+	using Atom = std::uint32_t;
+
+	inline constexpr Atom NoAtom = std::numeric_limits<Atom>::max();
+
+	class Interner final {
+	public:
+		static constexpr Atom KeywordCount = static_cast<Atom>(TokenType::TypeOfKeyword) - static_cast<Atom>(TokenType::ModuleKeyword) + 1;
+
+	private:
+		std::unordered_map<std::string_view, Atom> m_Atoms;
+		std::vector<std::string_view> m_Spellings;
+		Arena m_Arena;
+
+	public:
+		Interner();
+		Interner(const Interner&) = delete;
+		Interner(Interner&& interner) noexcept;
+		~Interner() = default;
+
+	public:
+		Interner& operator=(const Interner&) = delete;
+		Interner& operator=(Interner&& interner) noexcept;
+
+	public:
+		Atom Intern(std::string_view spelling);
+		Atom Find(std::string_view spelling) const noexcept;
+		std::string_view Spelling(Atom atom) const noexcept;
+		std::size_t Size() const noexcept;
+
+		static constexpr bool IsKeyword(Atom atom) noexcept {
+			return atom < KeywordCount;
+		}
+		static constexpr TokenType GetKeyword(Atom atom) noexcept {
+			return static_cast<TokenType>(static_cast<Atom>(TokenType::ModuleKeyword) + atom);
+		}
+		static constexpr Atom GetKeywordAtom(TokenType keyword) noexcept {
+			return static_cast<Atom>(keyword) - static_cast<Atom>(TokenType::ModuleKeyword);
+		}
+	};
+}
\ No newline at end of file
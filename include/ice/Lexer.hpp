@@ -1,33 +1,31 @@
 #pragma once
 
+#include <ice/Interner.hpp>
 #include <ice/Message.hpp>
+#include <ice/ThreadPool.hpp>
+#include <ice/TokenType.hpp>
 #include <ice/detail/Config.hpp>
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <istream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace ice {
-	enum class TokenType {
-#define E(x) x
-#include <ice/detail/TokenType.txt>
-#undef E
-	};
-
 	class Token final {
-	private:
-		static const std::unordered_map<TokenType, std::string> m_TypeNames;
-
 	private:
 		TokenType m_Type = TokenType::None;
-		std::string m_Word;
+		std::string_view m_Word;
 		std::size_t m_Line = 0, m_Column = 0;
+		ice::Atom m_Atom = NoAtom;
 
 	public:
 		Token() noexcept = default;
-		Token(TokenType type, std::string word, std::size_t line, std::size_t column) noexcept;
+		Token(TokenType type, std::string_view word, std::size_t line, std::size_t column, ice::Atom atom = NoAtom) noexcept;
 		Token(const Token& token);
 		Token(Token&& token) noexcept;
 		~Token() = default;
@@ -39,29 +37,86 @@ namespace ice {
 	public:
 		TokenType Type() const noexcept;
 		void Type(TokenType newType) noexcept;
-		std::string Word() const;
-		void Word(std::string newWord) noexcept;
+		std::string_view Word() const noexcept;
+		void Word(std::string_view newWord) noexcept;
 		std::size_t Line() const noexcept;
 		void Line(std::size_t newLine) noexcept;
 		std::size_t Column() const noexcept;
 		void Column(std::size_t newColumn) noexcept;
+		ice::Atom Atom() const noexcept;
+		void Atom(ice::Atom newAtom) noexcept;
 
 	public:
 		std::string ToString() const;
 	};
 
-	class Lexer final {
+	class TokenBuffer final {
 	private:
-		static const std::unordered_map<std::string, TokenType> m_Keywords;
-		static const std::unordered_map<char, const std::array<TokenType, 5>> m_Operators;
-		static const std::unordered_map<TokenType, std::string> m_OperatorWords;
+		std::string_view m_Source;
+		std::size_t m_FirstLine = 1;
+		std::vector<TokenType> m_Types;
+		std::vector<std::uint32_t> m_Offsets;
+		std::vector<std::uint32_t> m_Lengths;
+		std::vector<std::uint32_t> m_LineBegins;
+		std::vector<ice::Atom> m_Atoms;
+
+	public:
+		TokenBuffer() noexcept = default;
+		TokenBuffer(const TokenBuffer& tokenBuffer);
+		TokenBuffer(TokenBuffer&& tokenBuffer) noexcept;
+		~TokenBuffer() = default;
+
+	public:
+		TokenBuffer& operator=(const TokenBuffer& tokenBuffer);
+		TokenBuffer& operator=(TokenBuffer&& tokenBuffer) noexcept;
+		Token operator[](std::size_t index) const noexcept;
+
+	public:
+		void Clear() noexcept;
+		void Reset(std::string_view source, std::size_t firstLine) noexcept;
+		void Reserve(std::size_t tokenCount, std::size_t lineCount);
+		bool IsEmpty() const noexcept;
+		std::size_t Size() const noexcept;
+		std::string_view Source() const noexcept;
+		void Source(std::string_view newSource) noexcept;
+		std::size_t FirstLine() const noexcept;
+		std::size_t LineCount() const noexcept;
+		std::size_t FindLine(std::size_t offset) const noexcept;
+
+		TokenType Type(std::size_t index) const noexcept;
+		std::string_view Word(std::size_t index) const noexcept;
+		std::size_t Offset(std::size_t index) const noexcept;
+		std::size_t Line(std::size_t index) const noexcept;
+		std::size_t Column(std::size_t index) const noexcept;
+		ice::Atom Atom(std::size_t index) const noexcept;
+		bool HasAtoms() const noexcept;
+		const std::vector<TokenType>& Types() const noexcept;
+		const std::vector<std::uint32_t>& Offsets() const noexcept;
+		const std::vector<std::uint32_t>& Lengths() const noexcept;
+		const std::vector<std::uint32_t>& LineBegins() const noexcept;
+		const std::vector<ice::Atom>& Atoms() const noexcept;
+
+		void Add(TokenType type, std::size_t offset, std::size_t length);
+		void Add(TokenType type, std::size_t offset, std::size_t length, ice::Atom atom);
+		void AddLine(std::size_t offset);
+		void Append(const TokenBuffer& tokenBuffer);
+		void Append(const TokenBuffer& tokenBuffer, std::size_t offset);
+		void Assign(std::string_view source, std::size_t firstLine, const TokenType* types, const std::uint32_t* offsets, const std::uint32_t* lengths,
+					const ice::Atom* atoms, std::size_t tokenCount, const std::uint32_t* lineBegins, std::size_t lineCount);
+		void RemapAtoms(const std::vector<ice::Atom>& atoms) noexcept;
+		void Intern(Interner& interner);
+	};
 
+	class Lexer final {
 	private:
-		std::vector<Token> m_Tokens;
+		TokenBuffer m_Tokens;
+		Interner* m_Interner = nullptr;
 
 		const std::string* m_SourceName = nullptr;
+		std::uint32_t m_Source = NoSource;
 		Messages* m_Messages = nullptr;
-		std::string m_LineSource;
+		std::string_view m_LineSource;
+		std::size_t m_LineOffset = 0;
 		std::size_t m_Line = 1,
 					m_Column = 0;
 		bool m_IsIdentifier = false;
@@ -72,9 +127,21 @@ namespace ice {
 		bool m_HasError = false;
 		char m_Char = 0;
 		int m_CharLength = 0;
+		std::vector<std::size_t> m_NonASCIILines;
+		std::size_t m_NonASCIILineIndex = 0;
+		std::vector<std::pair<std::size_t, std::size_t>> m_InvalidSequences;
+		std::size_t m_InvalidSequenceIndex = 0;
+
+		std::istream* m_Stream = nullptr;
+		std::string m_StreamSourceName;
+		std::string m_StreamBuffer;
+		std::size_t m_StreamLineBegin = 0;
+		std::size_t m_StreamTokenIndex = 0;
+		bool m_IsStreamEnd = false;
 
 	public:
 		Lexer() noexcept = default;
+		explicit Lexer(Interner& interner) noexcept;
 		Lexer(Lexer&& lexer) noexcept;
 		~Lexer() = default;
 
@@ -84,11 +151,20 @@ namespace ice {
 	public:
 		void Clear() noexcept;
 		bool IsEmpty() const noexcept;
-		std::vector<Token> Tokens() noexcept;
+		TokenBuffer Tokens() noexcept;
 
-		bool Lex(const std::string& sourceName, const std::string& source, Messages& messages);
+		bool Lex(const std::string& sourceName, std::string_view source, Messages& messages);
+		bool LexParallel(const std::string& sourceName, std::string_view source, Messages& messages, ThreadPool& pool);
+		void Open(const std::string& sourceName, std::istream& stream, Messages& messages);
+		bool NextToken(Token& token);
 
 	private:
+		bool LexLines(const std::string& sourceName, std::string_view source, std::string_view lines, Messages& messages, std::size_t firstLine);
+		void Begin(const std::string& sourceName, Messages& messages);
+		bool End();
+		bool LexNextLine();
+		void ValidateLines(std::string_view lines);
+		ISINLINE void LexLine(std::string_view line);
 		ISINLINE bool Next();
 		
 		ISINLINE bool ReadDigits(std::size_t& end, bool(*digitChecker1)(char), bool(*digitChecker2)(char), const char* base);
@@ -102,7 +178,12 @@ namespace ice {
 		ISINLINE void LexDecIntegerOrDecimal();
 		ISINLINE void LexOtherIntegers();
 		ISINLINE void LexStringOrCharacter(char quotation);
-		ISINLINE bool LexSpecialCharacters();
+		ISINLINE void LexOperator(const std::array<TokenType, 5>& operators);
+		ISINLINE void AddToken(TokenType type, std::size_t column, std::size_t length, ice::Atom atom = NoAtom);
 		ISINLINE bool AddIdentifier();
+
+		std::uint32_t SourceId();
+		template<DiagnosticId Id, typename... Arguments>
+		void AddError(std::size_t column, std::size_t length, const Arguments&... arguments);
 	};
 }
\ No newline at end of file
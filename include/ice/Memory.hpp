@@ -2,25 +2,239 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace ice {
 	class Stack final {
+	public:
+		static constexpr std::size_t DefaultReserveSize = 16 * 1024 * 1024;
+		static constexpr std::size_t CommitSize = 64 * 1024;
+		static constexpr std::size_t Alignment = 16;
+
 	private:
-		std::uint8_t* m_Data = nullptr;
-		std::size_t m_Size = 0;
+		std::uint8_t* m_Base = nullptr;
+		std::uint8_t* m_Top = nullptr;
+		std::uint8_t* m_Committed = nullptr;
+		std::uint8_t* m_Limit = nullptr;
+		std::size_t m_ReservedSize = 0;
 
 	public:
-		Stack();
-		Stack(std::size_t size);
+		Stack() noexcept;
+		explicit Stack(std::size_t reserveSize) noexcept;
+		Stack(const Stack&) = delete;
 		Stack(Stack&& stack) noexcept;
 		~Stack();
-		
+
 	public:
+		Stack& operator=(const Stack&) = delete;
 		Stack& operator=(Stack&& stack) noexcept;
-		const std::uint8_t& operator[](std::size_t index) const noexcept;
-		std::uint8_t& operator[](std::size_t index) noexcept;
 
 	public:
+		bool IsReserved() const noexcept;
+		bool IsEmpty() const noexcept;
+		std::size_t Size() const noexcept;
+		std::size_t Capacity() const noexcept;
+		std::size_t CommittedSize() const noexcept;
+		std::uint8_t* Base() const noexcept;
+		std::uint8_t* Top() const noexcept;
+		void Clear() noexcept;
+		void Trim() noexcept;
+
+		void* Allocate(std::size_t size) noexcept {
+			const std::size_t alignedSize = (size + Alignment - 1) & ~(Alignment - 1);
+			if (alignedSize < size) return nullptr;
+
+			if (alignedSize <= static_cast<std::size_t>(m_Committed - m_Top) || Commit(alignedSize)) {
+				std::uint8_t* const result = m_Top;
+				m_Top += alignedSize;
+				return result;
+			} else return nullptr;
+		}
+		bool Free(const void* top) noexcept {
+			std::uint8_t* const newTop = static_cast<std::uint8_t*>(const_cast<void*>(top));
+			if (newTop < m_Base || newTop > m_Top || (reinterpret_cast<std::uintptr_t>(newTop) & (Alignment - 1)) != 0) return false;
+
+			m_Top = newTop;
+			return true;
+		}
+
+		template<typename T>
+		T* Push(const T& value) noexcept {
+			static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= Alignment, "stack values must be trivially copyable and fit the stack alignment");
+
+			void* const data = Allocate(sizeof(T));
+			return data ? new(data) T(value) : nullptr;
+		}
+		template<typename T>
+		bool Pop(T& value) noexcept {
+			static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= Alignment, "stack values must be trivially copyable and fit the stack alignment");
+
+			constexpr std::size_t size = (sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+			if (static_cast<std::size_t>(m_Top - m_Base) < size) return false;
+
+			m_Top -= size;
+			value = *std::launder(reinterpret_cast<T*>(m_Top));
+			return true;
+		}
+		template<typename T>
+		T* Peek() const noexcept {
+			constexpr std::size_t size = (sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+			if (static_cast<std::size_t>(m_Top - m_Base) < size) return nullptr;
+			return std::launder(reinterpret_cast<T*>(m_Top - size));
+		}
+
+		template<typename T>
+		T* AllocateFrame(std::size_t count) noexcept {
+			static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= Alignment, "frame elements must be trivially copyable and fit the stack alignment");
+
+			if (count > (std::numeric_limits<std::size_t>::max() - Alignment) / sizeof(T)) return nullptr;
+			return static_cast<T*>(Allocate(sizeof(T) * count));
+		}
+		template<typename T>
+		bool FreeFrame(const T* frame) noexcept {
+			return Free(frame);
+		}
+
+	private:
+		bool Commit(std::size_t size) noexcept;
+		void Release() noexcept;
+	};
+
+	template<typename T>
+	class Span final {
+	private:
+		T* m_Data = nullptr;
+		std::size_t m_Size = 0;
+
+	public:
+		constexpr Span() noexcept = default;
+		constexpr Span(T* data, std::size_t size) noexcept
+			: m_Data(data), m_Size(size) {
+		}
+		constexpr Span(const Span& span) noexcept = default;
+		~Span() = default;
+
+	public:
+		constexpr Span& operator=(const Span& span) noexcept = default;
+		constexpr T& operator[](std::size_t index) const noexcept {
+			return m_Data[index];
+		}
+
+	public:
+		constexpr T* begin() const noexcept {
+			return m_Data;
+		}
+		constexpr T* end() const noexcept {
+			return m_Data + m_Size;
+		}
+
+		constexpr bool IsEmpty() const noexcept {
+			return m_Size == 0;
+		}
+		constexpr std::size_t Size() const noexcept {
+			return m_Size;
+		}
+		constexpr T* Data() const noexcept {
+			return m_Data;
+		}
+	};
+
+	class Arena final {
+	public:
+		static constexpr std::size_t DefaultSlabSize = 64 * 1024;
+
+	private:
+		struct Slab final {
+			Slab* Next;
+			std::size_t Size;
+		};
+		struct Finalizer final {
+			Finalizer* Next;
+			void* Object;
+			void(*Destroy)(void* object) noexcept;
+		};
+
+	private:
+		Slab* m_Slabs = nullptr;
+		std::uint8_t* m_Current = nullptr;
+		std::uint8_t* m_End = nullptr;
+		Finalizer* m_Finalizers = nullptr;
+		std::size_t m_SlabSize = DefaultSlabSize;
+		std::size_t m_Size = 0;
+		std::size_t m_Capacity = 0;
+
+	public:
+		Arena() noexcept = default;
+		explicit Arena(std::size_t slabSize) noexcept;
+		Arena(const Arena&) = delete;
+		Arena(Arena&& arena) noexcept;
+		~Arena();
+
+	public:
+		Arena& operator=(const Arena&) = delete;
+		Arena& operator=(Arena&& arena) noexcept;
+
+	public:
+		void Clear() noexcept;
+		void Reset() noexcept;
 		std::size_t Size() const noexcept;
+		std::size_t Capacity() const noexcept;
+
+		void* Allocate(std::size_t size, std::size_t alignment) {
+			const std::uintptr_t current = reinterpret_cast<std::uintptr_t>(m_Current);
+			std::uint8_t* const begin = m_Current + (((current + alignment - 1) & ~(alignment - 1)) - current);
+			if (begin <= m_End && size <= static_cast<std::size_t>(m_End - begin)) {
+				m_Current = begin + size;
+				m_Size += size;
+				return begin;
+			} else return AllocateSlow(size, alignment);
+		}
+		template<typename T, typename... Arguments>
+		T* Make(Arguments&&... arguments) {
+			T* const object = new(Allocate(sizeof(T), alignof(T))) T(std::forward<Arguments>(arguments)...);
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				AddFinalizer(object, [](void* object) noexcept {
+					static_cast<T*>(object)->~T();
+				});
+			}
+			return object;
+		}
+		template<typename T>
+		Span<T> MakeSpan(std::size_t size) {
+			static_assert(std::is_trivially_destructible_v<T>, "arena spans never run destructors");
+
+			T* const data = static_cast<T*>(Allocate(sizeof(T) * size, alignof(T)));
+			for (std::size_t i = 0; i < size; ++i) {
+				new(data + i) T();
+			}
+			return Span<T>(data, size);
+		}
+		template<typename T>
+		Span<T> MakeSpan(const T* elements, std::size_t size) {
+			static_assert(std::is_trivially_destructible_v<T>, "arena spans never run destructors");
+
+			T* const data = static_cast<T*>(Allocate(sizeof(T) * size, alignof(T)));
+			for (std::size_t i = 0; i < size; ++i) {
+				new(data + i) T(elements[i]);
+			}
+			return Span<T>(data, size);
+		}
+		template<typename T>
+		Span<T> MakeSpan(std::initializer_list<T> elements) {
+			return MakeSpan<T>(elements.begin(), elements.size());
+		}
+		std::string_view MakeString(std::string_view string);
+
+	private:
+		void* AllocateSlow(std::size_t size, std::size_t alignment);
+		Slab* AddSlab(std::size_t size, bool isCurrent);
+		static std::uint8_t* GetSlabData(Slab* slab) noexcept;
+		void AddFinalizer(void* object, void(*destroy)(void* object) noexcept);
+		void RunFinalizers() noexcept;
 	};
 }
\ No newline at end of file
@@ -1,58 +1,156 @@
 #pragma once
 
+#include <ice/DiagnosticSink.hpp>
+#include <ice/Utility.hpp>
+
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ice {
-	enum class MessageType {
+	class DiagnosticEngine;
+
+	enum class MessageType : std::uint8_t {
 		None,
 		Note,
 		Warning,
 		Error,
 	};
 
+	enum class DiagnosticId : std::uint16_t {
+#define E(x, y) x
+#include <ice/detail/Diagnostic.txt>
+#undef E
+	};
+
+	namespace detail {
+		inline constexpr std::string_view DiagnosticFormats[] = {
+#define E(x, y) y
+#include <ice/detail/Diagnostic.txt>
+#undef E
+		};
+	}
+
+	std::string_view GetDiagnosticName(DiagnosticId id) noexcept;
+	constexpr std::string_view GetDiagnosticFormat(DiagnosticId id) noexcept {
+		return detail::DiagnosticFormats[static_cast<std::size_t>(id)];
+	}
+	constexpr std::size_t GetDiagnosticArgumentCount(DiagnosticId id) noexcept {
+		return GetFormatArgumentCount(GetDiagnosticFormat(id));
+	}
+
+	inline constexpr std::uint32_t NoSource = std::numeric_limits<std::uint32_t>::max();
+	inline constexpr std::uint32_t NoSnippet = std::numeric_limits<std::uint32_t>::max();
+
+	enum class MessageArgumentType : std::uint8_t {
+		None,
+		Character,
+		Integer,
+		String,
+		Span,
+		OwnedString,
+	};
+
+	class MessageArgument final {
+	private:
+		MessageArgumentType m_Type = MessageArgumentType::None;
+		std::uint32_t m_Length = 0;
+		union {
+			char m_Character;
+			std::int64_t m_Integer;
+			const char* m_String;
+			std::uint32_t m_Begin;
+		};
+
+	public:
+		MessageArgument() noexcept;
+		MessageArgument(char character) noexcept;
+		MessageArgument(std::int64_t integer) noexcept;
+		MessageArgument(const char* string) noexcept;
+		MessageArgument(std::string_view string) noexcept;
+		MessageArgument(const MessageArgument& messageArgument) noexcept = default;
+		~MessageArgument() = default;
+
+	public:
+		MessageArgument& operator=(const MessageArgument& messageArgument) noexcept = default;
+
+	public:
+		static MessageArgument Span(std::size_t begin, std::size_t length) noexcept;
+		static MessageArgument OwnedString(std::size_t begin, std::size_t length) noexcept;
+
+	public:
+		MessageArgumentType Type() const noexcept;
+		char Character() const noexcept;
+		std::int64_t Integer() const noexcept;
+		std::string_view String() const noexcept;
+		std::size_t Begin() const noexcept;
+		std::size_t Length() const noexcept;
+	};
+
 	class Message final {
+	public:
+		static constexpr std::size_t MaxArguments = 2;
+
 	private:
 		MessageType m_Type = MessageType::None;
-		std::string m_Description;
-		std::string m_Location;
-		std::string m_Note;
+		DiagnosticId m_Id = DiagnosticId::None;
+		std::uint32_t m_Source = NoSource;
+		std::uint32_t m_Line = 0,
+					  m_Column = 0,
+					  m_Length = 0;
+		std::uint32_t m_Snippet = NoSnippet,
+					  m_SnippetLength = 0;
+		std::array<MessageArgument, MaxArguments> m_Arguments;
 
 	public:
-		Message(MessageType type, std::string description);
-		Message(MessageType type, std::string description, std::string location);
-		Message(MessageType type, std::string description, std::string location, std::string note);
-		Message(const Message& message);
-		Message(Message&& message) noexcept;
+		Message() noexcept = default;
+		Message(MessageType type, DiagnosticId id, std::uint32_t source = NoSource) noexcept;
+		Message(MessageType type, DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length,
+				std::initializer_list<MessageArgument> arguments) noexcept;
+		Message(const Message& message) noexcept;
 		~Message() = default;
 
 	public:
-		Message& operator=(const Message& message);
-		Message& operator=(Message&& message) noexcept;
+		Message& operator=(const Message& message) noexcept;
 
 	public:
 		MessageType Type() const noexcept;
-		std::string Description() const;
-		std::string Location() const;
-		std::string Note() const;
-
-	public:
-		std::string ToString() const;
+		DiagnosticId Id() const noexcept;
+		std::uint32_t Source() const noexcept;
+		void Source(std::uint32_t newSource) noexcept;
+		std::size_t Line() const noexcept;
+		void Line(std::size_t newLine) noexcept;
+		std::size_t Column() const noexcept;
+		std::size_t Length() const noexcept;
+		bool HasSnippet() const noexcept;
+		std::uint32_t Snippet() const noexcept;
+		std::size_t SnippetLength() const noexcept;
+		void Snippet(std::uint32_t newSnippet, std::size_t newSnippetLength) noexcept;
+		const MessageArgument& Argument(std::size_t index) const noexcept;
+		void Argument(std::size_t index, const MessageArgument& newArgument) noexcept;
 	};
 
-	std::string CreateMessageLocation(std::size_t line, std::size_t column);
-	std::string CreateMessageLocation(const std::string& source);
-	std::string CreateMessageLocation(const std::string& source, std::size_t line, std::size_t column);
-	std::string CreateMessageNoteLocation(const std::string& source, std::size_t line, std::size_t column, std::size_t length);
-
 	class Messages final {
 	private:
 		std::vector<Message> m_Messages;
+		std::vector<std::string> m_Sources;
+		std::string m_Snippets;
+		std::uint32_t m_LastSnippet = NoSnippet;
+		std::string m_Strings;
+		std::size_t m_ErrorCount = 0,
+					m_WarningCount = 0;
+		DiagnosticSink* m_Sink = nullptr;
+		DiagnosticEngine* m_Engine = nullptr;
 
 	public:
 		Messages() noexcept = default;
+		explicit Messages(DiagnosticSink& sink) noexcept;
+		explicit Messages(DiagnosticEngine& engine) noexcept;
 		Messages(const Messages& messages);
 		Messages(Messages&& messages) noexcept;
 		~Messages() = default;
@@ -60,20 +158,67 @@ namespace ice {
 	public:
 		Messages& operator=(const Messages& messages);
 		Messages& operator=(Messages&& messages) noexcept;
+		const Message& operator[](std::size_t index) const noexcept;
 
 	public:
 		void Clear() noexcept;
 		bool IsEmpty() const noexcept;
+		std::size_t Size() const noexcept;
 		bool HasErrors() const noexcept;
+		std::size_t ErrorCount() const noexcept;
+		std::size_t WarningCount() const noexcept;
 		void Print() const;
+		void Print(DiagnosticSink& sink) const;
+		DiagnosticSink* Sink() const noexcept;
+		void Sink(DiagnosticSink* newSink) noexcept;
+		DiagnosticEngine* Engine() const noexcept;
+		void Engine(DiagnosticEngine* newEngine) noexcept;
+
+		std::uint32_t AddSource(std::string_view name);
+		std::string_view SourceName(std::uint32_t source) const noexcept;
+		std::string_view Snippet(const Message& message) const noexcept;
+
+		std::string Description(const Message& message) const;
+		std::string Location(const Message& message) const;
+		std::string Note(const Message& message) const;
+		std::string ToString(const Message& message) const;
+		void AppendDescription(std::string& result, const Message& message) const;
+		void AppendLocation(std::string& result, const Message& message) const;
+		void AppendNote(std::string& result, const Message& message) const;
+		void Append(std::string& result, const Message& message) const;
 
 		void Add(Message message);
-		void AddNote(const std::string& description, const std::string& source);
-		void AddNote(const std::string& description, const std::string& source, std::size_t line, std::size_t column);
-		void AddNote(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note);
-		void AddWarning(const std::string& description, const std::string& source, std::size_t line, std::size_t column);
-		void AddWarning(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note);
-		void AddError(const std::string& description, const std::string& source, std::size_t line, std::size_t column);
-		void AddError(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note);
+		void Add(Message message, std::string_view snippet);
+		void Merge(Messages messages);
+		void Sort();
+		void ShiftLines(std::size_t lineDelta) noexcept;
+		void AddNote(DiagnosticId id, std::uint32_t source = NoSource);
+		void AddNote(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments = {});
+		void AddNote(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+					 std::initializer_list<MessageArgument> arguments = {});
+		void AddWarning(DiagnosticId id, std::uint32_t source = NoSource);
+		void AddWarning(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments = {});
+		void AddWarning(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+						std::initializer_list<MessageArgument> arguments = {});
+		void AddError(DiagnosticId id, std::uint32_t source = NoSource);
+		void AddError(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments = {});
+		void AddError(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+					  std::initializer_list<MessageArgument> arguments = {});
+
+		template<DiagnosticId Id, typename... Arguments>
+		void AddNote(std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet, const Arguments&... arguments) {
+			static_assert(GetDiagnosticArgumentCount(Id) == sizeof...(Arguments), "argument count does not match the diagnostic format");
+			AddNote(Id, source, line, column, length, snippet, { MessageArgument(arguments)... });
+		}
+		template<DiagnosticId Id, typename... Arguments>
+		void AddWarning(std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet, const Arguments&... arguments) {
+			static_assert(GetDiagnosticArgumentCount(Id) == sizeof...(Arguments), "argument count does not match the diagnostic format");
+			AddWarning(Id, source, line, column, length, snippet, { MessageArgument(arguments)... });
+		}
+		template<DiagnosticId Id, typename... Arguments>
+		void AddError(std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet, const Arguments&... arguments) {
+			static_assert(GetDiagnosticArgumentCount(Id) == sizeof...(Arguments), "argument count does not match the diagnostic format");
+			AddError(Id, source, line, column, length, snippet, { MessageArgument(arguments)... });
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+#include <ice/TokenType.hpp>
+#include <ice/ast/Tree.hpp>
+#include <ice/detail/Config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ice {
+	class Parser final {
+	public:
+		static constexpr std::size_t MaxDepth = 256;
+
+	private:
+		Interner* m_Interner = nullptr;
+		ast::Tree* m_Tree = nullptr;
+
+		const std::string* m_SourceName = nullptr;
+		std::uint32_t m_Source = NoSource;
+		Messages* m_Messages = nullptr;
+
+		const TokenBuffer* m_Tokens = nullptr;
+		const TokenType* m_Types = nullptr;
+		std::size_t m_TokenCount = 0;
+		Lexer* m_Lexer = nullptr;
+		Token m_Token;
+
+		TokenType m_Type = TokenType::None;
+		std::uint32_t m_Index = 0;
+		std::size_t m_ParenDepth = 0;
+		std::size_t m_Depth = 0;
+		bool m_IsRecovering = false;
+		std::uint32_t m_ErrorIndex = ast::NoTokenIndex;
+		bool m_HasError = false;
+		std::vector<ast::NodeIndex> m_Scratch;
+
+	public:
+		Parser() noexcept = default;
+		explicit Parser(Interner& interner) noexcept;
+		Parser(const Parser&) = delete;
+		~Parser() = default;
+
+	public:
+		Parser& operator=(const Parser&) = delete;
+
+	public:
+		bool Parse(const std::string& sourceName, const TokenBuffer& tokens, ast::Tree& tree, Messages& messages);
+		bool Parse(const std::string& sourceName, Lexer& lexer, ast::Tree& tree, Messages& messages);
+		std::size_t TokenCount() const noexcept;
+
+	private:
+		bool Begin(const std::string& sourceName, ast::Tree& tree, Messages& messages);
+		ast::NodeIndex ParseSourceFile();
+
+		ast::NodeIndex ParseStatement();
+		ast::NodeIndex ParseBlock();
+		ast::NodeIndex ParseModuleOrImport(ast::NodeKind kind);
+		ast::NodeIndex ParseVariableDecl();
+		ast::NodeIndex ParseFunctionDecl();
+		ast::NodeIndex ParseParameter();
+		ast::NodeIndex ParseIf();
+		ast::NodeIndex ParseWhile();
+		ast::NodeIndex ParseDoWhile();
+		ast::NodeIndex ParseFor();
+		ast::NodeIndex ParseJump(ast::NodeKind kind, bool hasOperand);
+		bool ExpectStatementEnd();
+
+		ast::NodeIndex ParseExpression(int minPrecedence = 1);
+		ast::NodeIndex ParsePrefix();
+		ast::NodeIndex ParseInfix(ast::NodeIndex lhs, int precedence);
+		ast::NodeIndex ParseGroup(ast::NodeKind kind, TokenType close);
+		ast::NodeIndex ParseCall(ast::NodeKind kind, std::uint32_t token, ast::NodeIndex first);
+		ast::NodeIndex ParseType();
+		ast::NodeIndex ParseQualifiedName();
+		ast::NodeIndex ParseIdentifier();
+
+		ISINLINE void Next() {
+			do {
+				++m_Index;
+				if (m_Lexer == nullptr) {
+					m_Type = m_Index < m_TokenCount ? m_Types[m_Index] : TokenType::None;
+				} else if (m_Lexer->NextToken(m_Token)) {
+					m_Type = m_Token.Type();
+				} else {
+					m_Type = TokenType::None;
+				}
+			} while (m_Type == TokenType::EOL && m_ParenDepth != 0);
+
+			if (m_Type == TokenType::None && m_Index > m_TokenCount && m_Lexer == nullptr) {
+				m_Index = static_cast<std::uint32_t>(m_TokenCount);
+			}
+		}
+		ISINLINE void SkipEOLs() {
+			while (m_Type == TokenType::EOL) {
+				Next();
+			}
+		}
+		ISINLINE bool Accept(TokenType type) {
+			if (m_Type != type) return false;
+
+			Next();
+			return true;
+		}
+		bool Expect(TokenType type);
+		Atom CurrentAtom();
+		ast::NodeIndex AddList(ast::NodeKind kind, std::uint32_t token, std::size_t scratchBegin);
+		bool Enter();
+		void Leave() noexcept;
+
+		ast::NodeIndex AddErrorNode();
+		void Synchronize();
+		std::uint32_t SourceId();
+		template<DiagnosticId Id, typename... Arguments>
+		void AddError(const Arguments&... arguments);
+	};
+}
\ No newline at end of file
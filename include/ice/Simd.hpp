@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace ice {
+	std::size_t SkipWhitespaces(std::string_view source, std::size_t begin) noexcept;
+	std::size_t SkipIdentifierCharacters(std::string_view source, std::size_t begin) noexcept;
+	std::size_t FindCharacter(std::string_view source, std::size_t begin, char character) noexcept;
+	std::size_t FindNonASCII(std::string_view source, std::size_t begin) noexcept;
+	std::size_t FindInvalidUTF8(std::string_view source, std::size_t begin) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ice {
+	class ThreadPool final {
+	public:
+		using Task = std::function<void()>;
+
+	private:
+		struct Worker final {
+			std::mutex Mutex;
+			std::deque<Task> Tasks;
+		};
+
+	private:
+		std::vector<std::unique_ptr<Worker>> m_Workers;
+		std::vector<std::thread> m_Threads;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		std::condition_variable m_IdleCondition;
+		std::atomic<std::size_t> m_QueuedCount = 0;
+		std::atomic<std::size_t> m_PendingCount = 0;
+		std::atomic<std::size_t> m_NextWorker = 0;
+		bool m_IsStopping = false;
+
+	public:
+		explicit ThreadPool(std::size_t threadCount);
+		ThreadPool(const ThreadPool&) = delete;
+		~ThreadPool();
+
+	public:
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+	public:
+		std::size_t Size() const noexcept;
+		void Submit(Task task);
+		void Wait();
+		void Wait(const std::atomic<std::size_t>& pendingCount);
+
+	private:
+		void Run(std::size_t index);
+		bool Pop(std::size_t index, Task& task);
+		bool Steal(std::size_t index, Task& task);
+		void Finish();
+	};
+}
\ No newline at end of file
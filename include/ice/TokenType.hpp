@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ice {
+	enum class TokenType : std::uint8_t {
+#define E(x, y) x
+#include <ice/detail/TokenType.txt>
+#undef E
+	};
+
+	namespace detail {
+		inline constexpr std::string_view TokenTypeWords[] = {
+#define E(x, y) y
+#include <ice/detail/TokenType.txt>
+#undef E
+		};
+	}
+
+	constexpr std::string_view GetTokenTypeWord(TokenType type) noexcept {
+		return detail::TokenTypeWords[static_cast<std::size_t>(type)];
+	}
+}
\ No newline at end of file
@@ -1,8 +1,39 @@
 #pragma once
 
+#include <charconv>
+#include <cstddef>
+#include <iterator>
 #include <string>
-#include <vector>
+#include <string_view>
+#include <type_traits>
 
 namespace ice {
-	std::string Format(const std::string& format, const std::vector<std::string>& arguments);
+	using FormatArgumentAppender = void(*)(std::string& result, std::size_t index, const void* context);
+
+	constexpr std::size_t GetFormatArgumentCount(std::string_view format) noexcept {
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < format.size(); ++i) {
+			if (format[i] != '%') continue;
+			else if (i + 1 < format.size() && format[i + 1] == '%') {
+				++i;
+			} else {
+				++result;
+			}
+		}
+		return result;
+	}
+
+	void VFormatTo(std::string& result, std::string_view format, std::size_t argumentCount, FormatArgumentAppender appender, const void* context);
+
+	void AppendFormatArgument(std::string& result, char argument);
+	void AppendFormatArgument(std::string& result, bool argument);
+	void AppendFormatArgument(std::string& result, const char* argument);
+	void AppendFormatArgument(std::string& result, std::string_view argument);
+	void AppendFormatArgument(std::string& result, const std::string& argument);
+	template<typename T>
+	std::enable_if_t<std::is_integral_v<T>> AppendFormatArgument(std::string& result, T argument) {
+		char buffer[24];
+		const auto [end, error] = std::to_chars(std::begin(buffer), std::end(buffer), argument);
+		result.append(buffer, end);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/ast/Tree.hpp>
+#include <ice/ast/Visitor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace ice::ast {
+	class Dumper : public Visitor {
+	protected:
+		std::ostream* m_Stream = nullptr;
+		const Interner* m_Interner = nullptr;
+		const TokenBuffer* m_Tokens = nullptr;
+		std::string m_Buffer;
+		std::size_t m_BufferSize = 0;
+
+	private:
+		Walker m_Walker;
+
+	public:
+		Dumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize);
+		virtual ~Dumper() override;
+
+	public:
+		virtual void Begin();
+		const TokenBuffer* Tokens() const noexcept;
+		void Tokens(const TokenBuffer* newTokens) noexcept;
+		void Dump(const Tree& tree);
+		void Dump(const Tree& tree, NodeIndex root);
+		void Flush();
+
+	protected:
+		void Commit();
+	};
+
+	class TextDumper final : public Dumper {
+	public:
+		explicit TextDumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize = 64 * 1024);
+		virtual ~TextDumper() override = default;
+
+	public:
+		virtual bool Enter(const Tree& tree, const VisitContext& context) override;
+	};
+
+	class BinaryDumper final : public Dumper {
+	public:
+		static constexpr std::uint8_t Version = 1;
+
+	public:
+		explicit BinaryDumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize = 64 * 1024);
+		virtual ~BinaryDumper() override = default;
+
+	public:
+		virtual void Begin() override;
+		virtual bool Enter(const Tree& tree, const VisitContext& context) override;
+
+	private:
+		void AppendVarint(std::uint64_t integer);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace ice::ast {
+	enum class NodeKind : std::uint8_t {
+#define E(x, y) x
+#include <ice/detail/NodeKind.txt>
+#undef E
+	};
+
+	enum class NodeLayout : std::uint8_t {
+		Leaf,
+		Unary,
+		Binary,
+		List,
+		Extra2,
+		Extra3,
+		Extra4,
+	};
+
+	namespace detail {
+		inline constexpr NodeLayout NodeLayouts[] = {
+#define E(x, y) NodeLayout::y
+#include <ice/detail/NodeKind.txt>
+#undef E
+		};
+	}
+
+	std::string_view GetNodeKindName(NodeKind kind) noexcept;
+	constexpr NodeLayout GetNodeLayout(NodeKind kind) noexcept {
+		return detail::NodeLayouts[static_cast<std::size_t>(kind)];
+	}
+
+	using NodeIndex = std::uint32_t;
+
+	inline constexpr NodeIndex NoNode = std::numeric_limits<NodeIndex>::max();
+	inline constexpr std::uint32_t NoTokenIndex = std::numeric_limits<std::uint32_t>::max();
+
+	class Tree final {
+	private:
+		std::vector<NodeKind> m_Kinds;
+		std::vector<std::uint32_t> m_Tokens;
+		std::vector<std::uint32_t> m_Lhs;
+		std::vector<std::uint32_t> m_Rhs;
+		std::vector<std::uint32_t> m_Extra;
+		NodeIndex m_Root = NoNode;
+
+	public:
+		Tree() noexcept = default;
+		Tree(const Tree& tree);
+		Tree(Tree&& tree) noexcept;
+		~Tree() = default;
+
+	public:
+		Tree& operator=(const Tree& tree);
+		Tree& operator=(Tree&& tree) noexcept;
+
+	public:
+		void Clear() noexcept;
+		void Reserve(std::size_t nodeCount, std::size_t extraCount);
+		bool IsEmpty() const noexcept;
+		std::size_t Size() const noexcept;
+		std::size_t ExtraSize() const noexcept;
+		std::size_t MemoryUsage() const noexcept;
+		NodeIndex Root() const noexcept;
+		void Root(NodeIndex newRoot) noexcept;
+
+		NodeKind Kind(NodeIndex node) const noexcept;
+		std::uint32_t Token(NodeIndex node) const noexcept;
+		std::uint32_t Lhs(NodeIndex node) const noexcept;
+		std::uint32_t Rhs(NodeIndex node) const noexcept;
+		std::uint32_t Extra(std::size_t index) const noexcept;
+		Span<const std::uint32_t> Extra(std::size_t index, std::size_t size) const noexcept;
+		const std::vector<NodeKind>& Kinds() const noexcept;
+		const std::vector<std::uint32_t>& Tokens() const noexcept;
+		const std::vector<std::uint32_t>& Lhs() const noexcept;
+		const std::vector<std::uint32_t>& Rhs() const noexcept;
+		const std::vector<std::uint32_t>& Extra() const noexcept;
+		std::size_t ChildCount(NodeIndex node) const noexcept;
+		NodeIndex Child(NodeIndex node, std::size_t index) const noexcept;
+
+		Atom Name(NodeIndex node) const noexcept;
+		Span<const NodeIndex> Elements(NodeIndex node) const noexcept;
+		NodeIndex Type(NodeIndex node) const noexcept;
+		NodeIndex Initialization(NodeIndex node) const noexcept;
+
+		NodeIndex Add(NodeKind kind, std::uint32_t token, std::uint32_t lhs = 0, std::uint32_t rhs = 0);
+		std::uint32_t AddExtra(const std::uint32_t* data, std::size_t size);
+		NodeIndex AddList(NodeKind kind, std::uint32_t token, const NodeIndex* children, std::size_t childCount);
+		NodeIndex AddRecord(NodeKind kind, std::uint32_t token, std::uint32_t lhs, std::initializer_list<NodeIndex> children);
+		NodeIndex AddBlock(std::uint32_t token, const NodeIndex* statements, std::size_t statementCount);
+		NodeIndex AddVariableDecl(std::uint32_t token, Atom name, NodeIndex type, NodeIndex initialization);
+		NodeIndex AddIdentifier(std::uint32_t token, Atom name);
+
+		void Assign(const NodeKind* kinds, const std::uint32_t* tokens, const std::uint32_t* lhs, const std::uint32_t* rhs, std::size_t nodeCount,
+					const std::uint32_t* extra, std::size_t extraCount, NodeIndex root);
+		void RemapAtoms(const std::vector<Atom>& atoms) noexcept;
+	};
+}
\ No newline at end of file
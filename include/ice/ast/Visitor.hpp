@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ice/ast/Tree.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace ice::ast {
+	struct VisitContext final {
+		NodeIndex Node = NoNode;
+		NodeIndex Parent = NoNode;
+		std::uint32_t Slot = 0;
+		std::uint32_t Depth = 0;
+	};
+
+	class Visitor {
+	public:
+		Visitor() noexcept = default;
+		Visitor(const Visitor&) = delete;
+		virtual ~Visitor() = default;
+
+	public:
+		Visitor& operator=(const Visitor&) = delete;
+
+	public:
+		virtual bool Enter(const Tree& tree, const VisitContext& context) = 0;
+		virtual void Leave(const Tree& tree, const VisitContext& context);
+	};
+
+	class Walker final {
+	private:
+		struct Frame final {
+			VisitContext Context;
+			std::uint32_t NextChild;
+			std::uint32_t ChildCount;
+		};
+
+	private:
+		std::vector<Frame> m_Frames;
+
+	public:
+		Walker() noexcept = default;
+		Walker(const Walker& walker);
+		Walker(Walker&& walker) noexcept;
+		~Walker() = default;
+
+	public:
+		Walker& operator=(const Walker& walker);
+		Walker& operator=(Walker&& walker) noexcept;
+
+	public:
+		void Walk(const Tree& tree, Visitor& visitor);
+		void Walk(const Tree& tree, NodeIndex root, Visitor& visitor);
+
+	private:
+		bool Push(const Tree& tree, const VisitContext& context, Visitor& visitor);
+	};
+}
\ No newline at end of file
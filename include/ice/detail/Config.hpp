@@ -6,4 +6,26 @@
 #	define ISINLINE __attribute__((always_inline))
 #else
 #	define inline
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#	define ISX64
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#	define ISTARGET(name) __attribute__((target(name)))
+#else
+#	define ISTARGET(name)
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(ISNOCOMPUTEDGOTO)
+#	define ISCOMPUTEDGOTO
+#endif
+
+#ifdef __SIZEOF_INT128__
+#	define ISINT128
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64) || defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
+#	define ISNANBOXING
 #endif
\ No newline at end of file
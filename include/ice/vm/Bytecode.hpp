@@ -0,0 +1,186 @@
+#pragma once
+
+#include <ice/vm/Value.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ice::vm {
+	enum class OpCode : std::uint16_t {
+#define E(x, y, z, w) x
+#include <ice/detail/OpCode.txt>
+#undef E
+		Count,
+	};
+
+	enum class OpFormat : std::uint8_t {
+		None,
+		A,
+		AB,
+		ABC,
+		ABx,
+		AsBx,
+		sBx,
+		ABsC,
+	};
+
+	enum class NumericType : std::uint8_t {
+		Int8,
+		Int16,
+		Int32,
+		Int64,
+		Int128,
+		UInt8,
+		UInt16,
+		UInt32,
+		UInt64,
+		UInt128,
+		Float32,
+		Float64,
+		Count,
+	};
+
+	namespace detail {
+		inline constexpr OpFormat OpFormats[] = {
+#define E(x, y, z, w) OpFormat::y
+#include <ice/detail/OpCode.txt>
+#undef E
+		};
+		inline constexpr bool OpJumps[] = {
+#define E(x, y, z, w) z
+#include <ice/detail/OpCode.txt>
+#undef E
+		};
+		inline constexpr bool OpWides[] = {
+#define E(x, y, z, w) w
+#include <ice/detail/OpCode.txt>
+#undef E
+		};
+	}
+
+	std::string_view GetOpCodeName(OpCode opCode) noexcept;
+	constexpr OpFormat GetOpFormat(OpCode opCode) noexcept {
+		return detail::OpFormats[static_cast<std::size_t>(opCode)];
+	}
+	constexpr bool IsJumpOpCode(OpCode opCode) noexcept {
+		return detail::OpJumps[static_cast<std::size_t>(opCode)];
+	}
+	constexpr bool IsWideOpCode(OpCode opCode) noexcept {
+		return detail::OpWides[static_cast<std::size_t>(opCode)];
+	}
+	constexpr bool IsWideNumericType(NumericType type) noexcept {
+		return type == NumericType::Int128 || type == NumericType::UInt128;
+	}
+
+	using Instruction = std::uint64_t;
+	using Register = std::uint64_t;
+
+	constexpr Instruction MakeInstruction(OpCode opCode, std::uint16_t a = 0, std::uint16_t b = 0, std::uint16_t c = 0) noexcept {
+		return static_cast<Instruction>(opCode) | static_cast<Instruction>(a) << 16 | static_cast<Instruction>(b) << 32 | static_cast<Instruction>(c) << 48;
+	}
+	constexpr Instruction MakeInstructionBx(OpCode opCode, std::uint16_t a, std::uint32_t bx) noexcept {
+		return static_cast<Instruction>(opCode) | static_cast<Instruction>(a) << 16 | static_cast<Instruction>(bx) << 32;
+	}
+	constexpr Instruction MakeInstructionSBx(OpCode opCode, std::uint16_t a, std::int32_t sbx) noexcept {
+		return MakeInstructionBx(opCode, a, static_cast<std::uint32_t>(sbx));
+	}
+	constexpr Instruction MakeInstructionSC(OpCode opCode, std::uint16_t a, std::uint16_t b, std::int16_t sc) noexcept {
+		return MakeInstruction(opCode, a, b, static_cast<std::uint16_t>(sc));
+	}
+	constexpr std::uint16_t MakeConversion(NumericType from, NumericType to) noexcept {
+		return static_cast<std::uint16_t>(static_cast<std::uint16_t>(from) | static_cast<std::uint16_t>(to) << 8);
+	}
+
+	constexpr OpCode GetOpCode(Instruction instruction) noexcept {
+		return static_cast<OpCode>(instruction & 0xFFFF);
+	}
+	constexpr std::uint16_t GetA(Instruction instruction) noexcept {
+		return static_cast<std::uint16_t>(instruction >> 16);
+	}
+	constexpr std::uint16_t GetB(Instruction instruction) noexcept {
+		return static_cast<std::uint16_t>(instruction >> 32);
+	}
+	constexpr std::uint16_t GetC(Instruction instruction) noexcept {
+		return static_cast<std::uint16_t>(instruction >> 48);
+	}
+	constexpr std::uint32_t GetBx(Instruction instruction) noexcept {
+		return static_cast<std::uint32_t>(instruction >> 32);
+	}
+	constexpr std::int32_t GetSBx(Instruction instruction) noexcept {
+		return static_cast<std::int32_t>(GetBx(instruction));
+	}
+	constexpr std::int16_t GetSC(Instruction instruction) noexcept {
+		return static_cast<std::int16_t>(GetC(instruction));
+	}
+	constexpr NumericType GetConversionSource(std::uint16_t conversion) noexcept {
+		return static_cast<NumericType>(conversion & 0xFF);
+	}
+	constexpr NumericType GetConversionTarget(std::uint16_t conversion) noexcept {
+		return static_cast<NumericType>(conversion >> 8);
+	}
+
+	class Function final {
+	private:
+		std::string m_Name;
+		std::vector<Instruction> m_Instructions;
+		std::vector<std::uint64_t> m_Constants;
+		std::uint16_t m_ParameterCount = 0;
+		std::uint16_t m_ResultCount = 0;
+		std::uint16_t m_RegisterCount = 0;
+
+	public:
+		Function() noexcept = default;
+		Function(std::string name, std::uint16_t parameterCount, std::uint16_t resultCount, std::uint16_t registerCount);
+		Function(const Function& function);
+		Function(Function&& function) noexcept;
+		~Function() = default;
+
+	public:
+		Function& operator=(const Function& function);
+		Function& operator=(Function&& function) noexcept;
+
+	public:
+		const std::string& Name() const noexcept;
+		std::uint16_t ParameterCount() const noexcept;
+		std::uint16_t ResultCount() const noexcept;
+		std::uint16_t RegisterCount() const noexcept;
+		void RegisterCount(std::uint16_t newRegisterCount) noexcept;
+		const std::vector<Instruction>& Instructions() const noexcept;
+		const std::vector<std::uint64_t>& Constants() const noexcept;
+		std::size_t Size() const noexcept;
+
+		std::size_t Emit(Instruction instruction);
+		void Patch(std::size_t index, Instruction instruction) noexcept;
+		std::uint32_t AddConstant(std::uint64_t constant);
+		std::uint32_t AddConstant(double constant);
+		std::uint32_t AddConstant(Value constant);
+	};
+
+	class Program final {
+	private:
+		std::vector<Function> m_Functions;
+
+	public:
+		Program() noexcept = default;
+		Program(const Program& program);
+		Program(Program&& program) noexcept;
+		~Program() = default;
+
+	public:
+		Program& operator=(const Program& program);
+		Program& operator=(Program&& program) noexcept;
+		const Function& operator[](std::size_t index) const noexcept;
+		Function& operator[](std::size_t index) noexcept;
+
+	public:
+		std::size_t Size() const noexcept;
+		const std::vector<Function>& Functions() const noexcept;
+		std::uint32_t AddFunction(Function function);
+		bool Verify(std::string* error = nullptr) const;
+		void Disassemble(std::ostream& stream) const;
+	};
+}
\ No newline at end of file
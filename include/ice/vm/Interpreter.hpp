@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ice/Memory.hpp>
+#include <ice/vm/Bytecode.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ice::vm {
+	enum class ExecutionStatus : std::uint8_t {
+		Success,
+		StackOverflow,
+		DivisionByZero,
+		TypeError,
+		UnsupportedInstruction,
+	};
+
+	std::string_view GetExecutionStatusName(ExecutionStatus status) noexcept;
+
+	class Interpreter final {
+	private:
+		ice::Stack m_Stack;
+
+	public:
+		Interpreter() noexcept = default;
+		explicit Interpreter(std::size_t stackSize) noexcept;
+		Interpreter(const Interpreter&) = delete;
+		Interpreter(Interpreter&& interpreter) noexcept;
+		~Interpreter() = default;
+
+	public:
+		Interpreter& operator=(const Interpreter&) = delete;
+		Interpreter& operator=(Interpreter&& interpreter) noexcept;
+
+	public:
+		const ice::Stack& ExecutionStack() const noexcept;
+		ExecutionStatus Run(const Program& program, std::uint32_t function, Span<const Register> arguments, Span<Register> results);
+	};
+}
\ No newline at end of file
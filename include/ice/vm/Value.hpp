@@ -0,0 +1,217 @@
+#pragma once
+
+#include <ice/detail/Config.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+namespace ice::vm {
+	enum class ValueType : std::uint8_t {
+		Null,
+		Bool,
+		Int,
+		Double,
+		Object,
+	};
+
+	std::string_view GetValueTypeName(ValueType type) noexcept;
+
+	class Value final {
+	public:
+		static constexpr std::uint64_t TagShift = 48;
+		static constexpr std::uint64_t PayloadMask = (static_cast<std::uint64_t>(1) << TagShift) - 1;
+		static constexpr std::uint64_t NullTag = 0xFFF9;
+		static constexpr std::uint64_t BoolTag = 0xFFFA;
+		static constexpr std::uint64_t IntTag = 0xFFFB;
+		static constexpr std::uint64_t ObjectTag = 0xFFFC;
+		static constexpr std::uint64_t CanonicalNaN = 0x7FF8000000000000;
+		static constexpr std::uint64_t ObjectAlignment = 8;
+
+	private:
+		std::uint64_t m_Bits = NullTag << TagShift;
+
+	public:
+		constexpr Value() noexcept = default;
+		constexpr Value(const Value& value) noexcept = default;
+		~Value() = default;
+
+	private:
+		explicit constexpr Value(std::uint64_t bits) noexcept
+			: m_Bits(bits) {
+		}
+
+	public:
+		constexpr Value& operator=(const Value& value) noexcept = default;
+
+	public:
+		static constexpr Value FromBits(std::uint64_t bits) noexcept {
+			return Value(bits);
+		}
+		static constexpr Value FromBool(bool value) noexcept {
+			return Value(BoolTag << TagShift | static_cast<std::uint64_t>(value));
+		}
+		static constexpr Value FromInt(std::int32_t value) noexcept {
+			return Value(IntTag << TagShift | static_cast<std::uint32_t>(value));
+		}
+		static Value FromDouble(double value) noexcept {
+			if (std::isnan(value)) return Value(CanonicalNaN);
+
+			std::uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return Value(bits);
+		}
+		static Value FromInteger(std::int64_t value) noexcept {
+			if (value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max()) return FromInt(static_cast<std::int32_t>(value));
+			else return FromDouble(static_cast<double>(value));
+		}
+		static Value FromNumber(double value) noexcept {
+			if (value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max()) {
+				const std::int32_t integer = static_cast<std::int32_t>(value);
+				if (integer == value && (integer != 0 || !std::signbit(value))) return FromInt(integer);
+			}
+			return FromDouble(value);
+		}
+		static Value FromObject(const void* object) noexcept {
+#ifdef ISNANBOXING
+			return Value(ObjectTag << TagShift | static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(object)));
+#else
+			return Value(ObjectTag << TagShift | static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(object) / ObjectAlignment));
+#endif
+		}
+
+		constexpr std::uint64_t Bits() const noexcept {
+			return m_Bits;
+		}
+		constexpr ValueType Type() const noexcept {
+			switch (m_Bits >> TagShift) {
+			case NullTag: return ValueType::Null;
+			case BoolTag: return ValueType::Bool;
+			case IntTag: return ValueType::Int;
+			case ObjectTag: return ValueType::Object;
+			default: return ValueType::Double;
+			}
+		}
+
+		constexpr bool IsNull() const noexcept {
+			return m_Bits == NullTag << TagShift;
+		}
+		constexpr bool IsBool() const noexcept {
+			return m_Bits >> TagShift == BoolTag;
+		}
+		constexpr bool IsInt() const noexcept {
+			return m_Bits >> TagShift == IntTag;
+		}
+		constexpr bool IsDouble() const noexcept {
+			return m_Bits < NullTag << TagShift;
+		}
+		constexpr bool IsNumber() const noexcept {
+			return IsDouble() || IsInt();
+		}
+		constexpr bool IsObject() const noexcept {
+			return m_Bits >> TagShift == ObjectTag;
+		}
+		constexpr bool IsFalsy() const noexcept {
+			return IsNull() || m_Bits == BoolTag << TagShift;
+		}
+		constexpr bool IsTruthy() const noexcept {
+			return !IsFalsy();
+		}
+
+		constexpr bool AsBool() const noexcept {
+			return (m_Bits & 1) != 0;
+		}
+		constexpr std::int32_t AsInt() const noexcept {
+			return static_cast<std::int32_t>(static_cast<std::uint32_t>(m_Bits));
+		}
+		double AsDouble() const noexcept {
+			double value;
+			std::memcpy(&value, &m_Bits, sizeof(value));
+			return value;
+		}
+		double AsNumber() const noexcept {
+			return IsInt() ? static_cast<double>(AsInt()) : AsDouble();
+		}
+		template<typename T = void>
+		T* AsObject() const noexcept {
+#ifdef ISNANBOXING
+			return reinterpret_cast<T*>(static_cast<std::uintptr_t>(m_Bits & PayloadMask));
+#else
+			return reinterpret_cast<T*>(static_cast<std::uintptr_t>(m_Bits & PayloadMask) * ObjectAlignment);
+#endif
+		}
+	};
+
+	inline bool Add(Value lhs, Value rhs, Value& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) {
+			result = Value::FromInteger(static_cast<std::int64_t>(lhs.AsInt()) + rhs.AsInt());
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = Value::FromDouble(lhs.AsNumber() + rhs.AsNumber());
+		} else return false;
+		return true;
+	}
+	inline bool Sub(Value lhs, Value rhs, Value& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) {
+			result = Value::FromInteger(static_cast<std::int64_t>(lhs.AsInt()) - rhs.AsInt());
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = Value::FromDouble(lhs.AsNumber() - rhs.AsNumber());
+		} else return false;
+		return true;
+	}
+	inline bool Mul(Value lhs, Value rhs, Value& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) {
+			const std::int64_t product = static_cast<std::int64_t>(lhs.AsInt()) * rhs.AsInt();
+			result = product == 0 && (lhs.AsInt() < 0 || rhs.AsInt() < 0) ? Value::FromDouble(-0.0) : Value::FromInteger(product);
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = Value::FromDouble(lhs.AsNumber() * rhs.AsNumber());
+		} else return false;
+		return true;
+	}
+	inline bool Div(Value lhs, Value rhs, Value& result) noexcept {
+		if (!lhs.IsNumber() || !rhs.IsNumber()) return false;
+
+		result = Value::FromDouble(lhs.AsNumber() / rhs.AsNumber());
+		return true;
+	}
+	inline bool Mod(Value lhs, Value rhs, Value& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt() && rhs.AsInt() != 0) {
+			const std::int64_t remainder = static_cast<std::int64_t>(lhs.AsInt()) % rhs.AsInt();
+			result = remainder == 0 && lhs.AsInt() < 0 ? Value::FromDouble(-0.0) : Value::FromInt(static_cast<std::int32_t>(remainder));
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = Value::FromDouble(std::fmod(lhs.AsNumber(), rhs.AsNumber()));
+		} else return false;
+		return true;
+	}
+	inline bool Neg(Value value, Value& result) noexcept {
+		if (value.IsInt()) {
+			result = value.AsInt() == 0 ? Value::FromDouble(-0.0) : Value::FromInteger(-static_cast<std::int64_t>(value.AsInt()));
+		} else if (value.IsDouble()) {
+			result = Value::FromDouble(-value.AsDouble());
+		} else return false;
+		return true;
+	}
+
+	inline bool Equal(Value lhs, Value rhs) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) return lhs.Bits() == rhs.Bits();
+		else if (lhs.IsNumber() && rhs.IsNumber()) return lhs.AsNumber() == rhs.AsNumber();
+		else return lhs.Bits() == rhs.Bits();
+	}
+	inline bool Less(Value lhs, Value rhs, bool& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) {
+			result = lhs.AsInt() < rhs.AsInt();
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = lhs.AsNumber() < rhs.AsNumber();
+		} else return false;
+		return true;
+	}
+	inline bool LessEqual(Value lhs, Value rhs, bool& result) noexcept {
+		if (lhs.IsInt() && rhs.IsInt()) {
+			result = lhs.AsInt() <= rhs.AsInt();
+		} else if (lhs.IsNumber() && rhs.IsNumber()) {
+			result = lhs.AsNumber() <= rhs.AsNumber();
+		} else return false;
+		return true;
+	}
+}
\ No newline at end of file
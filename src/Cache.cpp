@@ -0,0 +1,390 @@
+#include <ice/Cache.hpp>
+
+#include <ice/File.hpp>
+#include <ice/Hash.hpp>
+#include <ice/Parser.hpp>
+
+#ifdef _WIN32
+#	include <process.h>
+#else
+#	include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+	constexpr char s_Magic[8] = { 'I', 'C', 'E', 'C', 'A', 'C', 'H', 'E' };
+	constexpr std::uint32_t s_ByteOrder = 0x01020304;
+	constexpr std::size_t s_Alignment = 8;
+
+	constexpr std::string_view s_Layout[] = {
+#define E(x, y) #x
+#include <ice/detail/TokenType.txt>
+#undef E
+#define E(x, y) #x
+#include <ice/detail/NodeKind.txt>
+#undef E
+	};
+
+	struct Section final {
+		std::uint64_t Offset;
+		std::uint64_t Size;
+	};
+
+	struct Header final {
+		char Magic[8];
+		std::uint32_t ByteOrder;
+		std::uint32_t Version;
+		std::uint64_t Key;
+		std::uint64_t SourceSize;
+		std::uint64_t Checksum;
+		std::uint64_t FirstLine;
+		std::uint32_t Root;
+		std::uint32_t HasAtoms;
+
+		Section Types;
+		Section Offsets;
+		Section Lengths;
+		Section Atoms;
+		Section LineBegins;
+		Section Spellings;
+		Section Strings;
+		Section Kinds;
+		Section Tokens;
+		Section Lhs;
+		Section Rhs;
+		Section Extra;
+	};
+
+	std::uint64_t GetSeed() noexcept {
+		static const std::uint64_t seed = [] {
+			std::uint64_t result = ice::CompilationCache::FormatVersion;
+			for (std::string_view name : s_Layout) {
+				result = ice::Hash64(name, result);
+			}
+#ifdef __VERSION__
+			result = ice::Hash64(std::string_view(__VERSION__), result);
+#elif defined(_MSC_FULL_VER)
+			const std::uint64_t compilerVersion = _MSC_FULL_VER;
+			result = ice::Hash64(&compilerVersion, sizeof(compilerVersion), result);
+#endif
+			const std::uint64_t maxDepth = ice::Parser::MaxDepth;
+			return ice::Hash64(&maxDepth, sizeof(maxDepth), result);
+		}();
+		return seed;
+	}
+	std::string GetTemporaryExtension() {
+#ifdef _WIN32
+		const auto processId = _getpid();
+#else
+		const auto processId = getpid();
+#endif
+		return '.' + std::to_string(processId) + '.' + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+	}
+
+	template<typename T>
+	Section Append(std::string& buffer, const T* data, std::size_t count) {
+		buffer.resize((buffer.size() + s_Alignment - 1) / s_Alignment * s_Alignment);
+
+		const Section span{ buffer.size(), count };
+		if (count != 0) {
+			buffer.append(reinterpret_cast<const char*>(data), count * sizeof(T));
+		}
+		return span;
+	}
+	template<typename T>
+	const T* Resolve(std::string_view data, const Section& span, std::size_t count) noexcept {
+		if (span.Offset % s_Alignment != 0 || span.Size != count || span.Offset > data.size() ||
+			(data.size() - span.Offset) / sizeof(T) < span.Size) return nullptr;
+		return reinterpret_cast<const T*>(data.data() + span.Offset);
+	}
+
+	bool IsNode(std::uint32_t node, std::size_t nodeCount) noexcept {
+		return node < nodeCount || node == ice::ast::NoNode;
+	}
+	bool IsAtom(ice::Atom atom, std::size_t atomCount) noexcept {
+		return atom < atomCount || atom == ice::NoAtom;
+	}
+	bool IsValidTokens(std::string_view source, const std::uint32_t* offsets, const std::uint32_t* lengths, const ice::Atom* atoms, std::size_t tokenCount,
+					   std::size_t atomCount) noexcept {
+		for (std::size_t i = 0; i < tokenCount; ++i) {
+			if (offsets[i] > source.size() || source.size() - offsets[i] < lengths[i]) return false;
+			else if (atoms && !IsAtom(atoms[i], atomCount)) return false;
+		}
+		return true;
+	}
+	bool IsValidTree(const ice::ast::NodeKind* kinds, const std::uint32_t* lhs, const std::uint32_t* rhs, std::size_t nodeCount, const std::uint32_t* extra,
+					 std::size_t extraCount, ice::ast::NodeIndex root, std::size_t atomCount) noexcept {
+		if (!IsNode(root, nodeCount)) return false;
+
+		for (std::size_t i = 0; i < nodeCount; ++i) {
+			if (static_cast<std::size_t>(kinds[i]) >= std::size(ice::ast::detail::NodeLayouts)) return false;
+
+			std::size_t first = 0, count = 0;
+			switch (ice::ast::GetNodeLayout(kinds[i])) {
+			case ice::ast::NodeLayout::Unary:
+				if (!IsNode(lhs[i], nodeCount)) return false;
+				break;
+
+			case ice::ast::NodeLayout::Binary:
+				if (!IsNode(lhs[i], nodeCount) || !IsNode(rhs[i], nodeCount)) return false;
+				break;
+
+			case ice::ast::NodeLayout::List:
+				first = lhs[i];
+				count = rhs[i];
+				break;
+
+			case ice::ast::NodeLayout::Extra2:
+				first = rhs[i];
+				count = 2;
+				break;
+
+			case ice::ast::NodeLayout::Extra3:
+				first = rhs[i];
+				count = 3;
+				break;
+
+			case ice::ast::NodeLayout::Extra4:
+				first = rhs[i];
+				count = 4;
+				break;
+
+			default:
+				break;
+			}
+			if (first > extraCount || extraCount - first < count) return false;
+			for (std::size_t j = first; j < first + count; ++j) {
+				if (!IsNode(extra[j], nodeCount)) return false;
+			}
+
+			switch (kinds[i]) {
+			case ice::ast::NodeKind::VariableDecl:
+			case ice::ast::NodeKind::FunctionDecl:
+			case ice::ast::NodeKind::Parameter:
+			case ice::ast::NodeKind::Identifier:
+				if (!IsAtom(lhs[i], atomCount)) return false;
+				break;
+
+			case ice::ast::NodeKind::Member:
+				if (!IsAtom(rhs[i], atomCount)) return false;
+				break;
+
+			default:
+				break;
+			}
+		}
+		return true;
+	}
+}
+
+namespace ice {
+	CompilationCache::CompilationCache(std::string directory) noexcept
+		: m_Directory(std::move(directory)) {
+	}
+	CompilationCache::CompilationCache(const CompilationCache& cache)
+		: m_Directory(cache.m_Directory) {
+	}
+	CompilationCache::CompilationCache(CompilationCache&& cache) noexcept
+		: m_Directory(std::move(cache.m_Directory)) {
+	}
+
+	CompilationCache& CompilationCache::operator=(const CompilationCache& cache) {
+		m_Directory = cache.m_Directory;
+
+		return *this;
+	}
+	CompilationCache& CompilationCache::operator=(CompilationCache&& cache) noexcept {
+		m_Directory = std::move(cache.m_Directory);
+
+		return *this;
+	}
+
+	const std::string& CompilationCache::Directory() const noexcept {
+		return m_Directory;
+	}
+	void CompilationCache::Directory(std::string newDirectory) noexcept {
+		m_Directory = std::move(newDirectory);
+	}
+
+	std::uint64_t CompilationCache::Key(std::string_view source) noexcept {
+		return Hash64(source, GetSeed());
+	}
+	std::string CompilationCache::Path(const std::string& sourcePath, std::uint64_t key) const {
+		if (m_Directory.empty()) return sourcePath + ".icc";
+
+		static constexpr char digits[] = "0123456789abcdef";
+
+		std::string name(16, '0');
+		for (std::size_t i = 0; i < name.size(); ++i) {
+			name[name.size() - i - 1] = digits[(key >> (i * 4)) & 0xF];
+		}
+		return (std::filesystem::path(m_Directory) / (name + ".icc")).string();
+	}
+	bool CompilationCache::Load(const std::string& sourcePath, std::string_view source, Interner& interner, TokenBuffer& tokens,
+								ast::Tree& tree) const {
+		const std::uint64_t key = Key(source);
+
+		MappedFile file;
+		if (!file.Open(Path(sourcePath, key))) return false;
+
+		const std::string_view data = file.Data();
+		if (data.size() < sizeof(Header)) return false;
+
+		Header header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (std::memcmp(header.Magic, s_Magic, sizeof(s_Magic)) != 0 || header.ByteOrder != s_ByteOrder || header.Version != FormatVersion ||
+			header.Key != key || header.SourceSize != source.size()) return false;
+		if (Hash64(data.data() + sizeof(header), data.size() - sizeof(header)) != header.Checksum) return false;
+
+		const std::size_t tokenCount = header.Types.Size;
+		const std::size_t nodeCount = header.Kinds.Size;
+		const auto types = Resolve<TokenType>(data, header.Types, tokenCount);
+		const auto offsets = Resolve<std::uint32_t>(data, header.Offsets, tokenCount);
+		const auto lengths = Resolve<std::uint32_t>(data, header.Lengths, tokenCount);
+		const auto atoms = Resolve<Atom>(data, header.Atoms, header.HasAtoms ? tokenCount : 0);
+		const auto lineBegins = Resolve<std::uint32_t>(data, header.LineBegins, header.LineBegins.Size);
+		const auto spellings = Resolve<std::uint32_t>(data, header.Spellings, header.Spellings.Size);
+		const auto strings = Resolve<char>(data, header.Strings, header.Strings.Size);
+		const auto kinds = Resolve<ast::NodeKind>(data, header.Kinds, nodeCount);
+		const auto nodeTokens = Resolve<std::uint32_t>(data, header.Tokens, nodeCount);
+		const auto lhs = Resolve<std::uint32_t>(data, header.Lhs, nodeCount);
+		const auto rhs = Resolve<std::uint32_t>(data, header.Rhs, nodeCount);
+		const auto extra = Resolve<std::uint32_t>(data, header.Extra, header.Extra.Size);
+		if (!types || !offsets || !lengths || !atoms || !lineBegins || !spellings || !strings || !kinds || !nodeTokens || !lhs || !rhs || !extra ||
+			header.Spellings.Size % 2 != 0) return false;
+
+		const std::size_t atomCount = Interner::KeywordCount + header.Spellings.Size / 2;
+		if (!IsValidTokens(source, offsets, lengths, header.HasAtoms ? atoms : nullptr, tokenCount, atomCount) ||
+			!IsValidTree(kinds, lhs, rhs, nodeCount, extra, header.Extra.Size, header.Root, atomCount)) return false;
+
+		std::vector<Atom> localAtoms(atomCount);
+		bool isIdentity = true;
+		for (Atom i = 0; i < localAtoms.size(); ++i) {
+			if (Interner::IsKeyword(i)) {
+				localAtoms[i] = i;
+				continue;
+			}
+
+			const std::uint32_t* const spelling = spellings + (i - Interner::KeywordCount) * 2;
+			if (spelling[0] > header.Strings.Size || header.Strings.Size - spelling[0] < spelling[1]) return false;
+
+			localAtoms[i] = interner.Intern(std::string_view(strings + spelling[0], spelling[1]));
+			isIdentity &= localAtoms[i] == i;
+		}
+
+		tokens.Assign(source, header.FirstLine, types, offsets, lengths, header.HasAtoms ? atoms : nullptr, tokenCount, lineBegins,
+					  header.LineBegins.Size);
+		tree.Assign(kinds, nodeTokens, lhs, rhs, nodeCount, extra, header.Extra.Size, header.Root);
+		if (!isIdentity) {
+			tokens.RemapAtoms(localAtoms);
+			tree.RemapAtoms(localAtoms);
+		}
+		return true;
+	}
+	bool CompilationCache::Store(const std::string& sourcePath, std::string_view source, const Interner& interner, const TokenBuffer& tokens,
+								 const ast::Tree& tree) const {
+		std::vector<Atom> localAtoms(interner.Size(), NoAtom);
+		std::vector<std::uint32_t> spellings;
+		std::string strings;
+		const auto localize = [&](Atom atom) {
+			if (atom == NoAtom || Interner::IsKeyword(atom)) return atom;
+			if (localAtoms[atom] == NoAtom) {
+				const std::string_view spelling = interner.Spelling(atom);
+				localAtoms[atom] = static_cast<Atom>(Interner::KeywordCount + spellings.size() / 2);
+				spellings.push_back(static_cast<std::uint32_t>(strings.size()));
+				spellings.push_back(static_cast<std::uint32_t>(spelling.size()));
+				strings.append(spelling);
+			}
+			return localAtoms[atom];
+		};
+
+		std::vector<Atom> atoms;
+		if (tokens.HasAtoms()) {
+			atoms = tokens.Atoms();
+			for (Atom& atom : atoms) {
+				atom = localize(atom);
+			}
+		}
+
+		std::vector<std::uint32_t> lhs = tree.Lhs(), rhs = tree.Rhs();
+		for (ast::NodeIndex i = 0; i < tree.Size(); ++i) {
+			switch (tree.Kind(i)) {
+			case ast::NodeKind::VariableDecl:
+			case ast::NodeKind::FunctionDecl:
+			case ast::NodeKind::Parameter:
+			case ast::NodeKind::Identifier:
+				lhs[i] = localize(lhs[i]);
+				break;
+
+			case ast::NodeKind::Member:
+				rhs[i] = localize(rhs[i]);
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		Header header{};
+		std::memcpy(header.Magic, s_Magic, sizeof(s_Magic));
+		header.ByteOrder = s_ByteOrder;
+		header.Version = FormatVersion;
+		header.Key = Key(source);
+		header.SourceSize = source.size();
+		header.FirstLine = tokens.FirstLine();
+		header.Root = tree.Root();
+		header.HasAtoms = tokens.HasAtoms();
+
+		std::string buffer(sizeof(header), '\0');
+		header.Types = Append(buffer, tokens.Types().data(), tokens.Size());
+		header.Offsets = Append(buffer, tokens.Offsets().data(), tokens.Size());
+		header.Lengths = Append(buffer, tokens.Lengths().data(), tokens.Size());
+		header.Atoms = Append(buffer, atoms.data(), atoms.size());
+		header.LineBegins = Append(buffer, tokens.LineBegins().data(), tokens.LineBegins().size());
+		header.Spellings = Append(buffer, spellings.data(), spellings.size());
+		header.Strings = Append(buffer, strings.data(), strings.size());
+		header.Kinds = Append(buffer, tree.Kinds().data(), tree.Size());
+		header.Tokens = Append(buffer, tree.Tokens().data(), tree.Size());
+		header.Lhs = Append(buffer, lhs.data(), lhs.size());
+		header.Rhs = Append(buffer, rhs.data(), rhs.size());
+		header.Extra = Append(buffer, tree.Extra().data(), tree.ExtraSize());
+		header.Checksum = Hash64(buffer.data() + sizeof(header), buffer.size() - sizeof(header));
+		std::memcpy(buffer.data(), &header, sizeof(header));
+
+		const std::filesystem::path path = Path(sourcePath, header.Key);
+		std::error_code error;
+		if (!m_Directory.empty()) {
+			std::filesystem::create_directories(m_Directory, error);
+			if (error) return false;
+		}
+
+		std::filesystem::path temporaryPath = path;
+		temporaryPath += GetTemporaryExtension();
+		{
+			std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+			if (!stream || !stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size())) || !stream.flush()) {
+				stream.close();
+				std::filesystem::remove(temporaryPath, error);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(temporaryPath, path, error);
+		if (error) {
+			std::filesystem::remove(temporaryPath, error);
+			return false;
+		}
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include <ice/DiagnosticEngine.hpp>
+
+#include <utility>
+
+namespace ice {
+	void DiagnosticEngine::Clear() noexcept {
+		m_Buffers.clear();
+		m_ErrorCount.store(0, std::memory_order_relaxed);
+		m_WarningCount.store(0, std::memory_order_relaxed);
+	}
+	bool DiagnosticEngine::HasErrors() const noexcept {
+		return m_ErrorCount.load(std::memory_order_relaxed) != 0;
+	}
+	std::size_t DiagnosticEngine::ErrorCount() const noexcept {
+		return m_ErrorCount.load(std::memory_order_relaxed);
+	}
+	std::size_t DiagnosticEngine::WarningCount() const noexcept {
+		return m_WarningCount.load(std::memory_order_relaxed);
+	}
+	void DiagnosticEngine::Count(MessageType type, std::size_t count) noexcept {
+		if (type == MessageType::Error) {
+			m_ErrorCount.fetch_add(count, std::memory_order_relaxed);
+		} else if (type == MessageType::Warning) {
+			m_WarningCount.fetch_add(count, std::memory_order_relaxed);
+		}
+	}
+
+	Messages& DiagnosticEngine::Open() {
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Buffers.emplace_back(*this);
+	}
+	Messages DiagnosticEngine::Collect() {
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		Messages result;
+		for (Messages& buffer : m_Buffers) {
+			buffer.Engine(nullptr);
+			result.Merge(std::move(buffer));
+		}
+		m_Buffers.clear();
+
+		result.Sort();
+		return result;
+	}
+	void DiagnosticEngine::Print(DiagnosticSink& sink) {
+		Collect().Print(sink);
+	}
+}
\ No newline at end of file
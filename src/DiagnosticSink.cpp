@@ -0,0 +1,196 @@
+#include <ice/DiagnosticSink.hpp>
+
+#include <ice/Encoding.hpp>
+#include <ice/Message.hpp>
+#include <ice/Simd.hpp>
+
+#include <charconv>
+#include <iterator>
+#include <string_view>
+
+namespace {
+	constexpr char s_HexDigits[] = "0123456789abcdef";
+
+	void AppendInteger(std::string& result, std::size_t integer) {
+		char buffer[20];
+		const auto [end, error] = std::to_chars(std::begin(buffer), std::end(buffer), integer);
+		result.append(buffer, end);
+	}
+	void AppendJsonCharacters(std::string& result, std::string_view string) {
+		for (char c : string) {
+			switch (c) {
+			case '"':
+				result.append("\\\"");
+				break;
+
+			case '\\':
+				result.append("\\\\");
+				break;
+
+			case '\n':
+				result.append("\\n");
+				break;
+
+			case '\r':
+				result.append("\\r");
+				break;
+
+			case '\t':
+				result.append("\\t");
+				break;
+
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					result.append("\\u00");
+					result.push_back(s_HexDigits[static_cast<unsigned char>(c) >> 4]);
+					result.push_back(s_HexDigits[static_cast<unsigned char>(c) & 0xF]);
+				} else {
+					result.push_back(c);
+				}
+				break;
+			}
+		}
+	}
+	void AppendJsonString(std::string& result, std::string_view string) {
+		result.push_back('"');
+		std::size_t begin = 0;
+		while (begin < string.size()) {
+			const std::size_t end = ice::FindInvalidUTF8(string, begin);
+			AppendJsonCharacters(result, string.substr(begin, end - begin));
+			if (end == string.size()) break;
+
+			result.append("\\ufffd");
+			begin = end + ice::GetInvalidSequenceLength(string, end);
+		}
+		result.push_back('"');
+	}
+	std::string_view GetSeverityName(ice::MessageType type) noexcept {
+		switch (type) {
+		case ice::MessageType::Note: return "note";
+		case ice::MessageType::Warning: return "warning";
+		case ice::MessageType::Error: return "error";
+		default: return "none";
+		}
+	}
+}
+
+namespace ice {
+	void DiagnosticSink::Flush() {
+	}
+}
+
+namespace ice {
+	TerminalDiagnosticSink::TerminalDiagnosticSink(std::ostream& stream, std::size_t bufferSize)
+		: m_Stream(&stream), m_BufferSize(bufferSize) {
+		m_Buffer.reserve(bufferSize);
+	}
+	TerminalDiagnosticSink::~TerminalDiagnosticSink() {
+		Flush();
+	}
+
+	void TerminalDiagnosticSink::Write(const Messages& messages, const Message& message) {
+		if (m_IsFirst) {
+			m_IsFirst = false;
+		} else {
+			m_Buffer.push_back('\n');
+		}
+		messages.Append(m_Buffer, message);
+		m_Buffer.push_back('\n');
+
+		if (m_Buffer.size() >= m_BufferSize) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+	}
+	void TerminalDiagnosticSink::Flush() {
+		if (!m_Buffer.empty()) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+		m_Stream->flush();
+	}
+}
+
+namespace ice {
+	JsonDiagnosticSink::JsonDiagnosticSink(std::ostream& stream, std::size_t bufferSize)
+		: m_Stream(&stream), m_BufferSize(bufferSize) {
+		m_Buffer.reserve(bufferSize);
+	}
+	JsonDiagnosticSink::~JsonDiagnosticSink() {
+		Flush();
+	}
+
+	void JsonDiagnosticSink::Write(const Messages& messages, const Message& message) {
+		m_Buffer.append("{\"severity\":\"").append(GetSeverityName(message.Type()));
+		m_Buffer.append("\",\"id\":\"").append(GetDiagnosticName(message.Id())).append("\"");
+		if (message.Source() != NoSource) {
+			m_Buffer.append(",\"file\":");
+			AppendJsonString(m_Buffer, messages.SourceName(message.Source()));
+		}
+		if (message.Line() != 0) {
+			m_Buffer.append(",\"line\":");
+			AppendInteger(m_Buffer, message.Line());
+			m_Buffer.append(",\"column\":");
+			AppendInteger(m_Buffer, message.Column() + 1);
+			m_Buffer.append(",\"length\":");
+			AppendInteger(m_Buffer, message.Length());
+		}
+
+		m_Description.clear();
+		messages.AppendDescription(m_Description, message);
+		m_Buffer.append(",\"message\":");
+		AppendJsonString(m_Buffer, m_Description);
+		m_Buffer.append("}\n");
+
+		if (m_Buffer.size() >= m_BufferSize) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+	}
+	void JsonDiagnosticSink::Flush() {
+		if (!m_Buffer.empty()) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+		m_Stream->flush();
+	}
+}
+
+namespace ice {
+	void CountingDiagnosticSink::Write(const Messages&, const Message& message) {
+		switch (message.Type()) {
+		case MessageType::Note:
+			++m_NoteCount;
+			break;
+
+		case MessageType::Warning:
+			++m_WarningCount;
+			break;
+
+		case MessageType::Error:
+			++m_ErrorCount;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void CountingDiagnosticSink::Clear() noexcept {
+		m_NoteCount = 0;
+		m_WarningCount = 0;
+		m_ErrorCount = 0;
+	}
+	std::size_t CountingDiagnosticSink::Count() const noexcept {
+		return m_NoteCount + m_WarningCount + m_ErrorCount;
+	}
+	std::size_t CountingDiagnosticSink::NoteCount() const noexcept {
+		return m_NoteCount;
+	}
+	std::size_t CountingDiagnosticSink::WarningCount() const noexcept {
+		return m_WarningCount;
+	}
+	std::size_t CountingDiagnosticSink::ErrorCount() const noexcept {
+		return m_ErrorCount;
+	}
+}
\ No newline at end of file
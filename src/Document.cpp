@@ -0,0 +1,171 @@
+#include <ice/Document.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace ice {
+	Document::Document(std::string sourceName, Interner& interner) noexcept
+		: m_SourceName(std::move(sourceName)), m_Interner(&interner) {
+	}
+	Document::Document(const Document& document)
+		: m_SourceName(document.m_SourceName), m_Interner(document.m_Interner), m_Blocks(document.m_Blocks) {
+	}
+	Document::Document(Document&& document) noexcept
+		: m_SourceName(std::move(document.m_SourceName)), m_Interner(document.m_Interner), m_Blocks(std::move(document.m_Blocks)) {
+		document.m_Interner = nullptr;
+	}
+
+	Document& Document::operator=(const Document& document) {
+		m_SourceName = document.m_SourceName;
+		m_Interner = document.m_Interner;
+		m_Blocks = document.m_Blocks;
+
+		return *this;
+	}
+	Document& Document::operator=(Document&& document) noexcept {
+		m_SourceName = std::move(document.m_SourceName);
+		m_Interner = document.m_Interner;
+		m_Blocks = std::move(document.m_Blocks);
+
+		document.m_Interner = nullptr;
+
+		return *this;
+	}
+
+	void Document::Clear() noexcept {
+		m_Blocks.clear();
+	}
+	bool Document::IsEmpty() const noexcept {
+		return m_Blocks.empty();
+	}
+	const std::string& Document::SourceName() const noexcept {
+		return m_SourceName;
+	}
+	std::size_t Document::Size() const noexcept {
+		std::size_t result = 0;
+		for (const Block& block : m_Blocks) {
+			result += block.Text.size();
+		}
+		return result;
+	}
+	std::size_t Document::LineCount() const noexcept {
+		std::size_t result = 0;
+		for (const Block& block : m_Blocks) {
+			result += block.LineCount;
+		}
+		return result;
+	}
+	std::size_t Document::BlockCount() const noexcept {
+		return m_Blocks.size();
+	}
+	bool Document::HasErrors() const noexcept {
+		return std::any_of(m_Blocks.begin(), m_Blocks.end(), [](const Block& block) { return block.Diagnostics.HasErrors(); });
+	}
+
+	bool Document::Assign(std::string_view source) {
+		m_Blocks.clear();
+		return Insert(0, 0, source);
+	}
+	bool Document::Replace(std::size_t begin, std::size_t end, std::string_view replacement) {
+		if (m_Blocks.empty() || begin > end) return false;
+
+		std::size_t first = 0, firstBase = 0;
+		while (first + 1 < m_Blocks.size() && firstBase + m_Blocks[first].Text.size() <= begin) {
+			firstBase += m_Blocks[first++].Text.size();
+		}
+		std::size_t last = first, lastEnd = firstBase + m_Blocks[first].Text.size();
+		while (last + 1 < m_Blocks.size() && lastEnd <= end) {
+			lastEnd += m_Blocks[++last].Text.size();
+		}
+		if (end > lastEnd) return false;
+
+		std::string text;
+		text.reserve(lastEnd - firstBase - (end - begin) + replacement.size());
+		for (std::size_t i = first; i <= last; ++i) {
+			text.append(m_Blocks[i].Text);
+		}
+		text.replace(begin - firstBase, end - begin, replacement.data(), replacement.size());
+
+		return Insert(first, last + 1, text);
+	}
+	std::string Document::Text() const {
+		std::string result;
+		result.reserve(Size());
+		for (const Block& block : m_Blocks) {
+			result.append(block.Text);
+		}
+		return result;
+	}
+	TokenBuffer Document::Tokens(std::string_view text) const {
+		std::size_t tokenCount = 0;
+		for (const Block& block : m_Blocks) {
+			tokenCount += block.Tokens.Size();
+		}
+
+		TokenBuffer result;
+		result.Reset(text, 1);
+		result.Reserve(tokenCount, LineCount());
+
+		std::size_t offset = 0;
+		for (const Block& block : m_Blocks) {
+			result.Append(block.Tokens, offset);
+			offset += block.Text.size();
+		}
+		return result;
+	}
+	Messages Document::Diagnostics() const {
+		Messages result;
+		std::size_t firstLine = 1;
+		for (const Block& block : m_Blocks) {
+			if (!block.Diagnostics.IsEmpty()) {
+				Messages diagnostics = block.Diagnostics;
+				diagnostics.ShiftLines(firstLine - 1);
+				result.Merge(std::move(diagnostics));
+			}
+			firstLine += block.LineCount;
+		}
+		return result;
+	}
+
+	bool Document::Insert(std::size_t begin, std::size_t end, std::string_view text) {
+		const bool isLast = end == m_Blocks.size();
+
+		std::vector<Block> blocks;
+		std::size_t textBegin = 0;
+		while (textBegin < text.size()) {
+			const std::size_t lineEnd = text.find('\n', std::min(textBegin + BlockSize, text.size()) - 1);
+			const std::size_t textEnd = lineEnd == std::string_view::npos ? text.size() : lineEnd + 1;
+
+			blocks.emplace_back().Text = text.substr(textBegin, textEnd - textBegin);
+			textBegin = textEnd;
+		}
+		if (blocks.empty() && isLast) {
+			blocks.emplace_back();
+		}
+
+		bool result = true;
+		for (std::size_t i = 0; i < blocks.size(); ++i) {
+			result &= Lex(blocks[i], isLast && i + 1 == blocks.size());
+		}
+
+		const std::size_t overlap = std::min(blocks.size(), end - begin);
+		std::move(blocks.begin(), blocks.begin() + overlap, m_Blocks.begin() + begin);
+		if (overlap < end - begin) {
+			m_Blocks.erase(m_Blocks.begin() + begin + overlap, m_Blocks.begin() + end);
+		} else {
+			m_Blocks.insert(m_Blocks.begin() + end, std::make_move_iterator(blocks.begin() + overlap), std::make_move_iterator(blocks.end()));
+		}
+		return result;
+	}
+	bool Document::Lex(Block& block, bool isLast) {
+		const std::string_view text = isLast ? std::string_view(block.Text) : std::string_view(block.Text).substr(0, block.Text.size() - 1);
+
+		Lexer lexer = m_Interner ? Lexer(*m_Interner) : Lexer();
+		block.Diagnostics.Clear();
+		const bool result = lexer.Lex(m_SourceName, text, block.Diagnostics);
+		block.Tokens = lexer.Tokens();
+		block.Tokens.Source({});
+		block.LineCount = block.Tokens.LineCount();
+		return result;
+	}
+}
\ No newline at end of file
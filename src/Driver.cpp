@@ -0,0 +1,254 @@
+#include <ice/Driver.hpp>
+
+#include <ice/Parser.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+namespace {
+	std::uint32_t ScanQualifiedName(const ice::TokenBuffer& tokens, std::uint32_t index, std::string& name) {
+		const std::uint32_t begin = index;
+		while (index < tokens.Size() && tokens.Type(index) == ice::TokenType::Identifer) {
+			name.append(tokens.Word(index));
+			++index;
+			if (index + 1 >= tokens.Size() || tokens.Type(index) != ice::TokenType::Dot || tokens.Type(index + 1) != ice::TokenType::Identifer) break;
+
+			name.push_back('.');
+			++index;
+		}
+		return index - begin;
+	}
+}
+
+namespace ice {
+	Driver::Driver(std::size_t jobCount) noexcept
+		: m_JobCount(std::max<std::size_t>(jobCount, 1)) {
+	}
+
+	const Module& Driver::operator[](std::size_t index) const noexcept {
+		return m_Modules[index];
+	}
+
+	std::size_t Driver::Size() const noexcept {
+		return m_Modules.size();
+	}
+	std::size_t Driver::JobCount() const noexcept {
+		return m_JobCount;
+	}
+	const CompilationCache* Driver::Cache() const noexcept {
+		return m_Cache;
+	}
+	void Driver::Cache(const CompilationCache* newCache) noexcept {
+		m_Cache = newCache;
+	}
+
+	void Driver::Add(std::string path) {
+		Module& module = m_Modules.emplace_back();
+		module.Name = std::filesystem::path(path).stem().string();
+		module.Path = std::move(path);
+	}
+	bool Driver::Build(DiagnosticEngine& engine) {
+		ThreadPool pool(m_JobCount);
+
+		for (Module& module : m_Modules) {
+			module.Messages = &engine.Open();
+			pool.Submit([this, &pool, &module] { Scan(pool, module); });
+		}
+		pool.Wait();
+
+		Link();
+
+		std::vector<std::size_t> roots;
+		for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+			if (m_Modules[i].IsOpened && m_Modules[i].PendingImports.load(std::memory_order_relaxed) == 0) {
+				roots.push_back(i);
+			}
+		}
+		for (std::size_t root : roots) {
+			pool.Submit([this, &pool, root] { Compile(pool, root); });
+		}
+		pool.Wait();
+
+		ReportCycles();
+
+		bool isSucceeded = true;
+		for (const Module& module : m_Modules) {
+			isSucceeded &= module.IsSucceeded;
+		}
+		return isSucceeded;
+	}
+
+	void Driver::Scan(ThreadPool& pool, Module& module) {
+		const auto begin = std::chrono::steady_clock::now();
+		if (!module.File.Open(module.Path)) return;
+
+		module.IsOpened = true;
+
+		const std::string_view source = module.File.Data();
+		if (m_Cache && m_Cache->Load(module.Path, source, module.Interner, module.Tokens, module.Tree)) {
+			module.IsCached = true;
+		} else {
+			Lexer lexer(module.Interner);
+			lexer.LexParallel(module.Path, source, *module.Messages, pool);
+			module.Tokens = lexer.Tokens();
+		}
+
+		const TokenBuffer& tokens = module.Tokens;
+		for (std::uint32_t i = 0; i < tokens.Size(); ++i) {
+			const TokenType type = tokens.Type(i);
+			if (type != TokenType::ModuleKeyword && type != TokenType::ImportKeyword) continue;
+
+			std::string name;
+			const std::uint32_t nameTokenCount = ScanQualifiedName(tokens, i + 1, name);
+			if (nameTokenCount == 0) continue;
+
+			if (type == TokenType::ImportKeyword) {
+				module.Imports.push_back({ std::move(name), i + 1, nameTokenCount });
+			} else if (module.NameToken == ast::NoTokenIndex) {
+				module.Name = std::move(name);
+				module.NameToken = i + 1;
+				module.NameTokenCount = nameTokenCount;
+			}
+			i += nameTokenCount;
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		module.Seconds = std::chrono::duration<double>(end - begin).count();
+	}
+	void Driver::Link() {
+		m_ModuleNames.clear();
+		m_ModuleNames.reserve(m_Modules.size());
+		for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+			Module& module = m_Modules[i];
+			if (!module.IsOpened || m_ModuleNames.emplace(module.Name, i).second) continue;
+
+			if (module.NameToken != ast::NoTokenIndex) {
+				AddError<DiagnosticId::DuplicateModule>(module, module.NameToken, module.NameTokenCount);
+			} else {
+				AddError<DiagnosticId::DuplicateModule>(module, module.Name);
+			}
+		}
+
+		std::vector<std::size_t> imports;
+		for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+			Module& module = m_Modules[i];
+
+			imports.clear();
+			for (Import& import : module.Imports) {
+				const auto iter = m_ModuleNames.find(import.Name);
+				if (iter == m_ModuleNames.end()) {
+					AddError<DiagnosticId::UnknownModule>(module, import.Token, import.TokenCount);
+					continue;
+				}
+
+				import.Module = iter->second;
+				imports.push_back(import.Module);
+			}
+
+			std::sort(imports.begin(), imports.end());
+			imports.erase(std::unique(imports.begin(), imports.end()), imports.end());
+			for (std::size_t import : imports) {
+				m_Modules[import].Dependents.push_back(i);
+			}
+			module.PendingImports.store(imports.size(), std::memory_order_relaxed);
+		}
+	}
+	void Driver::Compile(ThreadPool& pool, std::size_t index) {
+		Module& module = m_Modules[index];
+		Compile(module);
+
+		for (std::size_t dependent : module.Dependents) {
+			if (m_Modules[dependent].PendingImports.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				pool.Submit([this, &pool, dependent] { Compile(pool, dependent); });
+			}
+		}
+	}
+	void Driver::Compile(Module& module) {
+		const auto begin = std::chrono::steady_clock::now();
+		if (!module.IsCached) {
+			Parser parser(module.Interner);
+			parser.Parse(module.Path, module.Tokens, module.Tree, *module.Messages);
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		if (m_Cache && !module.IsCached && module.Messages->ErrorCount() == 0 && module.Messages->WarningCount() == 0) {
+			m_Cache->Store(module.Path, module.File.Data(), module.Interner, module.Tokens, module.Tree);
+		}
+
+		module.Seconds += std::chrono::duration<double>(end - begin).count();
+		module.IsCompiled = true;
+		module.IsSucceeded = !module.Messages->HasErrors();
+	}
+	void Driver::ReportCycles() {
+		std::vector<std::size_t> remaining, importers(m_Modules.size());
+		for (std::size_t i = 0; i < m_Modules.size(); ++i) {
+			if (m_Modules[i].IsOpened && !m_Modules[i].IsCompiled) {
+				remaining.push_back(i);
+			}
+		}
+		if (remaining.empty()) return;
+
+		for (std::size_t i : remaining) {
+			for (std::size_t dependent : m_Modules[i].Dependents) {
+				importers[i] += !m_Modules[dependent].IsCompiled;
+			}
+		}
+
+		std::vector<std::size_t> peeled;
+		for (std::size_t i : remaining) {
+			if (importers[i] == 0) {
+				peeled.push_back(i);
+			}
+		}
+		while (!peeled.empty()) {
+			const std::size_t index = peeled.back();
+			peeled.pop_back();
+			m_Modules[index].IsCompiled = true;
+
+			for (const Import& import : m_Modules[index].Imports) {
+				if (import.Module != NoModule && !m_Modules[import.Module].IsCompiled && --importers[import.Module] == 0) {
+					peeled.push_back(import.Module);
+				}
+			}
+		}
+
+		for (std::size_t i : remaining) {
+			Module& module = m_Modules[i];
+			if (!module.IsCompiled) {
+				for (const Import& import : module.Imports) {
+					if (import.Module != NoModule && !m_Modules[import.Module].IsCompiled) {
+						AddError<DiagnosticId::ImportCycle>(module, import.Token, import.TokenCount);
+						break;
+					}
+				}
+			}
+		}
+		for (std::size_t i : remaining) {
+			Compile(m_Modules[i]);
+		}
+	}
+
+	template<DiagnosticId Id>
+	void Driver::AddError(Module& module, std::uint32_t token, std::uint32_t tokenCount) {
+		const TokenBuffer& tokens = module.Tokens;
+		const std::uint32_t last = token + tokenCount - 1;
+		const std::string_view source = tokens.Source();
+		const std::size_t column = tokens.Column(token);
+		const std::size_t length = tokens.Offset(last) + tokens.Word(last).size() - tokens.Offset(token);
+		const std::size_t lineBegin = tokens.Offset(token) - column;
+		std::size_t lineEnd = std::min(source.find('\n', lineBegin), source.size());
+		if (lineEnd > lineBegin && source[lineEnd - 1] == '\r') {
+			--lineEnd;
+		}
+
+		module.Messages->AddError<Id>(module.Messages->AddSource(module.Path), tokens.Line(token), column, length,
+									  source.substr(lineBegin, lineEnd - lineBegin), MessageArgument::Span(column, length));
+	}
+	template<DiagnosticId Id>
+	void Driver::AddError(Module& module, std::string_view argument) {
+		static_assert(GetDiagnosticArgumentCount(Id) == 1, "argument count does not match the diagnostic format");
+		module.Messages->AddError(Id, module.Messages->AddSource(module.Path), 1, 0, { MessageArgument(argument) });
+	}
+}
\ No newline at end of file
@@ -2,21 +2,53 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <unordered_map>
-#include <utility>
-
-template<>
-struct std::hash<std::pair<char32_t, char32_t>> {
-	std::size_t operator()(const std::pair<char32_t, char32_t>& pair) const noexcept {
-		const std::hash<char32_t> orgHash;
-		return orgHash(pair.first) + orgHash(pair.second);
-	}
-};
+#include <cstdint>
+#include <cstring>
 
 namespace {
-	const std::unordered_map<std::pair<char32_t, char32_t>, char> s_EastAsianWidthTable = {
 #include "detail/EastAsianWidthTable.txt"
-	};
+
+	constexpr char32_t s_MaxCodepoint = 0x10FFFF;
+	constexpr std::uint64_t s_NonASCIIMask = 0x8080808080808080;
+
+	int MatchCodepoint(std::string_view source, std::size_t begin, int& length) noexcept {
+		const unsigned char firstByte = static_cast<unsigned char>(source[begin]);
+		unsigned char secondMin = 0x80, secondMax = 0xBF;
+
+		if (firstByte < 0x80) {
+			length = 1;
+			return 1;
+		} else if (firstByte < 0xC2) {
+			length = 1;
+			return 0;
+		} else if (firstByte < 0xE0) {
+			length = 2;
+		} else if (firstByte < 0xF0) {
+			length = 3;
+			if (firstByte == 0xE0) {
+				secondMin = 0xA0;
+			} else if (firstByte == 0xED) {
+				secondMax = 0x9F;
+			}
+		} else if (firstByte < 0xF5) {
+			length = 4;
+			if (firstByte == 0xF0) {
+				secondMin = 0x90;
+			} else if (firstByte == 0xF4) {
+				secondMax = 0x8F;
+			}
+		} else {
+			length = 1;
+			return 0;
+		}
+
+		int matched = 1;
+		for (; matched < length && begin + matched < source.size(); ++matched) {
+			const unsigned char byte = static_cast<unsigned char>(source[begin + matched]);
+			if (matched == 1 ? byte < secondMin || byte > secondMax : (byte & 0xC0) != 0x80) break;
+		}
+		return matched;
+	}
 }
 
 namespace ice {
@@ -58,15 +90,50 @@ namespace ice {
 	}
 
 	bool IsFullWidth(char32_t character) noexcept {
-		if (character < 0x80) return false;
-		for (auto iter = s_EastAsianWidthTable.begin(); iter != s_EastAsianWidthTable.end(); ++iter) {
-			if (iter->first.first <= character && character <= iter->first.second) return iter->second == 'F';
-		}
-		return false;
+		if (character < 0x80 || character > s_MaxCodepoint) return false;
+
+		const std::uint64_t* const block = s_EastAsianWidthBlocks[s_EastAsianWidthBlockIndices[character >> s_EastAsianWidthBlockBits]];
+		const std::size_t bit = character & ((1 << s_EastAsianWidthBlockBits) - 1);
+		return (block[bit / 64] >> (bit % 64)) & 1;
 	}
 	bool IsHalfWidth(char32_t character) noexcept {
 		return !IsFullWidth(character);
 	}
+	std::size_t DisplayWidth(std::string_view string) noexcept {
+		std::size_t width = 0;
+		for (std::size_t i = 0; i < string.size();) {
+			if (string.size() - i >= sizeof(std::uint64_t)) {
+				std::uint64_t word;
+				std::memcpy(&word, string.data() + i, sizeof(word));
+				if ((word & s_NonASCIIMask) == 0) {
+					width += sizeof(word);
+					i += sizeof(word);
+					continue;
+				}
+			}
+
+			if (static_cast<unsigned char>(string[i]) < 0x80) {
+				++width;
+				++i;
+			} else if (const int length = GetValidCodepointLength(string, i); length != 0) {
+				width += IsFullWidth(GetCodepoint(string.data() + i, length)) ? 2 : 1;
+				i += length;
+			} else {
+				++width;
+				i += GetInvalidSequenceLength(string, i);
+			}
+		}
+		return width;
+	}
+
+	int GetValidCodepointLength(std::string_view source, std::size_t begin) noexcept {
+		int length;
+		return MatchCodepoint(source, begin, length) == length ? length : 0;
+	}
+	int GetInvalidSequenceLength(std::string_view source, std::size_t begin) noexcept {
+		int length;
+		return std::max(MatchCodepoint(source, begin, length), 1);
+	}
 
 	char32_t GetCodepoint(const char* begin, int length) noexcept {
 		switch (length) {
@@ -0,0 +1,140 @@
+#include <ice/File.hpp>
+
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace ice {
+	MappedFile::MappedFile(MappedFile&& file) noexcept
+		: m_Data(file.m_Data), m_Size(file.m_Size)
+#ifdef _WIN32
+		, m_File(file.m_File), m_Mapping(file.m_Mapping)
+#endif
+	{
+		file.m_Data = nullptr;
+		file.m_Size = 0;
+#ifdef _WIN32
+		file.m_File = file.m_Mapping = nullptr;
+#endif
+	}
+	MappedFile::~MappedFile() {
+		Close();
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept {
+		Close();
+
+		m_Data = file.m_Data;
+		m_Size = file.m_Size;
+#ifdef _WIN32
+		m_File = file.m_File;
+		m_Mapping = file.m_Mapping;
+#endif
+
+		file.m_Data = nullptr;
+		file.m_Size = 0;
+#ifdef _WIN32
+		file.m_File = file.m_Mapping = nullptr;
+#endif
+
+		return *this;
+	}
+
+	bool MappedFile::Open(const std::string& path) {
+		Close();
+
+#ifdef _WIN32
+		const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+										FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER size;
+		if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			return false;
+		} else if (size.QuadPart == 0) {
+			m_File = file;
+			return true;
+		}
+
+		const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr) {
+			CloseHandle(file);
+			return false;
+		}
+
+		const void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_Data = static_cast<const char*>(data);
+		m_Size = static_cast<std::size_t>(size.QuadPart);
+		m_File = file;
+		m_Mapping = mapping;
+		return true;
+#else
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file == -1) return false;
+
+		struct stat status;
+		if (fstat(file, &status) == -1 || !S_ISREG(status.st_mode)) {
+			close(file);
+			return false;
+		} else if (status.st_size == 0) {
+			close(file);
+			m_Data = "";
+			return true;
+		}
+
+		void* const data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (data == MAP_FAILED) return false;
+
+		madvise(data, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+
+		m_Data = static_cast<const char*>(data);
+		m_Size = static_cast<std::size_t>(status.st_size);
+		return true;
+#endif
+	}
+	void MappedFile::Close() noexcept {
+#ifdef _WIN32
+		if (m_Data != nullptr) {
+			UnmapViewOfFile(m_Data);
+		}
+		if (m_Mapping != nullptr) {
+			CloseHandle(m_Mapping);
+		}
+		if (m_File != nullptr) {
+			CloseHandle(m_File);
+		}
+		m_File = m_Mapping = nullptr;
+#else
+		if (m_Size != 0) {
+			munmap(const_cast<char*>(m_Data), m_Size);
+		}
+#endif
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+	bool MappedFile::IsOpen() const noexcept {
+#ifdef _WIN32
+		return m_File != nullptr;
+#else
+		return m_Data != nullptr;
+#endif
+	}
+	std::string_view MappedFile::Data() const noexcept {
+		return { m_Data, m_Size };
+	}
+}
\ No newline at end of file
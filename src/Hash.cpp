@@ -0,0 +1,89 @@
+#include <ice/Hash.hpp>
+
+#include <cstring>
+
+namespace {
+	constexpr std::uint64_t s_Prime1 = 0x9E3779B185EBCA87ull;
+	constexpr std::uint64_t s_Prime2 = 0xC2B2AE3D27D4EB4Full;
+	constexpr std::uint64_t s_Prime3 = 0x165667B19E3779F9ull;
+	constexpr std::uint64_t s_Prime4 = 0x85EBCA77C2B2AE63ull;
+	constexpr std::uint64_t s_Prime5 = 0x27D4EB2F165667C5ull;
+
+	constexpr std::uint64_t RotateLeft(std::uint64_t value, int count) noexcept {
+		return (value << count) | (value >> (64 - count));
+	}
+	std::uint64_t Read64(const std::uint8_t* data) noexcept {
+		std::uint64_t result;
+		std::memcpy(&result, data, sizeof(result));
+		return result;
+	}
+	std::uint32_t Read32(const std::uint8_t* data) noexcept {
+		std::uint32_t result;
+		std::memcpy(&result, data, sizeof(result));
+		return result;
+	}
+
+	constexpr std::uint64_t Round(std::uint64_t accumulator, std::uint64_t input) noexcept {
+		return RotateLeft(accumulator + input * s_Prime2, 31) * s_Prime1;
+	}
+	constexpr std::uint64_t MergeRound(std::uint64_t accumulator, std::uint64_t value) noexcept {
+		return (accumulator ^ Round(0, value)) * s_Prime1 + s_Prime4;
+	}
+}
+
+namespace ice {
+	std::uint64_t Hash64(const void* data, std::size_t size, std::uint64_t seed) noexcept {
+		const std::uint8_t* input = static_cast<const std::uint8_t*>(data);
+		const std::uint8_t* const end = input + size;
+
+		std::uint64_t result;
+		if (size >= 32) {
+			std::uint64_t v1 = seed + s_Prime1 + s_Prime2;
+			std::uint64_t v2 = seed + s_Prime2;
+			std::uint64_t v3 = seed;
+			std::uint64_t v4 = seed - s_Prime1;
+
+			const std::uint8_t* const limit = end - 32;
+			do {
+				v1 = Round(v1, Read64(input));
+				v2 = Round(v2, Read64(input + 8));
+				v3 = Round(v3, Read64(input + 16));
+				v4 = Round(v4, Read64(input + 24));
+				input += 32;
+			} while (input <= limit);
+
+			result = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+			result = MergeRound(result, v1);
+			result = MergeRound(result, v2);
+			result = MergeRound(result, v3);
+			result = MergeRound(result, v4);
+		} else {
+			result = seed + s_Prime5;
+		}
+		result += static_cast<std::uint64_t>(size);
+
+		for (; input + 8 <= end; input += 8) {
+			result ^= Round(0, Read64(input));
+			result = RotateLeft(result, 27) * s_Prime1 + s_Prime4;
+		}
+		if (input + 4 <= end) {
+			result ^= static_cast<std::uint64_t>(Read32(input)) * s_Prime1;
+			result = RotateLeft(result, 23) * s_Prime2 + s_Prime3;
+			input += 4;
+		}
+		for (; input < end; ++input) {
+			result ^= *input * s_Prime5;
+			result = RotateLeft(result, 11) * s_Prime1;
+		}
+
+		result ^= result >> 33;
+		result *= s_Prime2;
+		result ^= result >> 29;
+		result *= s_Prime3;
+		result ^= result >> 32;
+		return result;
+	}
+	std::uint64_t Hash64(std::string_view data, std::uint64_t seed) noexcept {
+		return Hash64(data.data(), data.size(), seed);
+	}
+}
\ No newline at end of file
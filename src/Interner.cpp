@@ -0,0 +1,49 @@
+#include <ice/Interner.hpp>
+
+#include <utility>
+
+namespace ice {
+	Interner::Interner() {
+		m_Atoms.reserve(KeywordCount);
+		m_Spellings.reserve(KeywordCount);
+
+		for (Atom atom = 0; atom < KeywordCount; ++atom) {
+			const std::string_view spelling = GetTokenTypeWord(GetKeyword(atom));
+			m_Atoms.emplace(spelling, atom);
+			m_Spellings.push_back(spelling);
+		}
+	}
+	Interner::Interner(Interner&& interner) noexcept
+		: m_Atoms(std::move(interner.m_Atoms)), m_Spellings(std::move(interner.m_Spellings)), m_Arena(std::move(interner.m_Arena)) {
+	}
+
+	Interner& Interner::operator=(Interner&& interner) noexcept {
+		m_Atoms = std::move(interner.m_Atoms);
+		m_Spellings = std::move(interner.m_Spellings);
+		m_Arena = std::move(interner.m_Arena);
+
+		return *this;
+	}
+
+	Atom Interner::Intern(std::string_view spelling) {
+		const auto iter = m_Atoms.find(spelling);
+		if (iter != m_Atoms.end()) return iter->second;
+
+		const Atom atom = static_cast<Atom>(m_Spellings.size());
+		const std::string_view stored = m_Arena.MakeString(spelling);
+		m_Atoms.emplace(stored, atom);
+		m_Spellings.push_back(stored);
+		return atom;
+	}
+	Atom Interner::Find(std::string_view spelling) const noexcept {
+		const auto iter = m_Atoms.find(spelling);
+		if (iter != m_Atoms.end()) return iter->second;
+		else return NoAtom;
+	}
+	std::string_view Interner::Spelling(Atom atom) const noexcept {
+		return m_Spellings[atom];
+	}
+	std::size_t Interner::Size() const noexcept {
+		return m_Spellings.size();
+	}
+}
\ No newline at end of file
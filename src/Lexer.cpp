@@ -1,9 +1,12 @@
 #include <ice/Lexer.hpp>
 
 #include <ice/Encoding.hpp>
-#include <ice/Utility.hpp>
+#include <ice/Simd.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <sstream>
 #include <utility>
 
@@ -11,23 +14,132 @@
 #	pragma warning(disable: 4100)
 #endif
 
-namespace ice {
-	const std::unordered_map<TokenType, std::string> Token::m_TypeNames = {
-#define E(x) { TokenType:: x, #x }
+namespace {
+	using ice::GetTokenTypeWord;
+	using ice::TokenType;
+
+	constexpr std::string_view s_TokenTypeNames[] = {
+#define E(x, y) #x
 #include <ice/detail/TokenType.txt>
 #undef E
 	};
 
-	Token::Token(TokenType type, std::string word, std::size_t line, std::size_t column) noexcept
-		: m_Type(type), m_Word(std::move(word)), m_Line(line), m_Column(column) {
+	constexpr std::size_t ToIndex(TokenType type) noexcept {
+		return static_cast<std::size_t>(type);
+	}
+
+	enum class CharClass : std::uint8_t {
+		Identifier,
+		Digit,
+		Quotation,
+		Whitespace,
+		Backslash,
+		CarriageReturn,
+		Operator,
+		Invalid,
+	};
+
+	struct CharInfo final {
+		CharClass Class = CharClass::Identifier;
+		std::array<TokenType, 5> Operators{};
+	};
+
+	constexpr std::array<CharInfo, 256> CreateCharTable() noexcept {
+		std::array<CharInfo, 256> result{};
+
+		for (unsigned char c = '0'; c <= '9'; ++c) {
+			result[c].Class = CharClass::Digit;
+		}
+		result['"'].Class = result['\''].Class = CharClass::Quotation;
+		result[' '].Class = result['\t'].Class = CharClass::Whitespace;
+		result['\\'].Class = CharClass::Backslash;
+		result['\r'].Class = CharClass::CarriageReturn;
+		result['`'].Class = result['@'].Class = result['#'].Class = result['$'].Class = CharClass::Invalid;
+
+		for (std::size_t i = ToIndex(TokenType::Plus); i <= ToIndex(TokenType::Question); ++i) {
+			const TokenType type = static_cast<TokenType>(i);
+			const std::string_view word = GetTokenTypeWord(type);
+			CharInfo& info = result[static_cast<unsigned char>(word[0])];
+
+			info.Class = CharClass::Operator;
+			if (word.size() == 1) {
+				info.Operators[0] = type;
+			} else if (word.size() == 3) {
+				info.Operators[3] = type;
+			} else if (word[1] == word[0]) {
+				info.Operators[1] = type;
+				if (word[1] == '=') {
+					info.Operators[2] = type;
+				}
+			} else if (word[1] == '=') {
+				info.Operators[2] = type;
+			} else {
+				info.Operators[4] = type;
+			}
+		}
+		return result;
+	}
+
+	constexpr std::array<CharInfo, 256> s_CharTable = CreateCharTable();
+
+	constexpr std::size_t HashKeyword(std::string_view word) noexcept {
+		return (word.size() +
+				static_cast<unsigned char>(word.front()) * 3 +
+				static_cast<unsigned char>(word.back()) * 14 +
+				static_cast<unsigned char>(word[word.size() / 2]) * 10) & 0xFF;
+	}
+	constexpr std::array<TokenType, 256> CreateKeywordTable() noexcept {
+		std::array<TokenType, 256> result{};
+
+		for (std::size_t i = ToIndex(TokenType::ModuleKeyword); i <= ToIndex(TokenType::TypeOfKeyword); ++i) {
+			result[HashKeyword(GetTokenTypeWord(static_cast<TokenType>(i)))] = static_cast<TokenType>(i);
+		}
+		return result;
+	}
+	constexpr std::size_t GetMaxKeywordLength() noexcept {
+		std::size_t result = 0;
+
+		for (std::size_t i = ToIndex(TokenType::ModuleKeyword); i <= ToIndex(TokenType::TypeOfKeyword); ++i) {
+			result = std::max(result, GetTokenTypeWord(static_cast<TokenType>(i)).size());
+		}
+		return result;
+	}
+
+	constexpr std::array<TokenType, 256> s_KeywordTable = CreateKeywordTable();
+	constexpr std::size_t s_MaxKeywordLength = GetMaxKeywordLength();
+
+	constexpr bool IsKeywordTablePerfect() noexcept {
+		for (std::size_t i = ToIndex(TokenType::ModuleKeyword); i <= ToIndex(TokenType::TypeOfKeyword); ++i) {
+			if (s_KeywordTable[HashKeyword(GetTokenTypeWord(static_cast<TokenType>(i)))] != static_cast<TokenType>(i)) return false;
+		}
+		return true;
+	}
+	static_assert(IsKeywordTablePerfect(), "HashKeyword must not collide between keywords");
+
+	constexpr std::size_t s_StreamChunkSize = 64 * 1024;
+	constexpr std::size_t s_ParallelChunkMinSize = 256 * 1024;
+
+	ISINLINE constexpr TokenType FindKeyword(std::string_view word) noexcept {
+		if (word.size() > s_MaxKeywordLength) return TokenType::None;
+
+		const TokenType keyword = s_KeywordTable[HashKeyword(word)];
+		if (keyword != TokenType::None && GetTokenTypeWord(keyword) == word) return keyword;
+		else return TokenType::None;
+	}
+}
+
+namespace ice {
+	Token::Token(TokenType type, std::string_view word, std::size_t line, std::size_t column, ice::Atom atom) noexcept
+		: m_Type(type), m_Word(word), m_Line(line), m_Column(column), m_Atom(atom) {
 	}
 	Token::Token(const Token& token)
-		: m_Type(token.m_Type), m_Word(token.m_Word), m_Line(token.m_Line), m_Column(token.m_Column) {
+		: m_Type(token.m_Type), m_Word(token.m_Word), m_Line(token.m_Line), m_Column(token.m_Column), m_Atom(token.m_Atom) {
 	}
 	Token::Token(Token&& token) noexcept
-		: m_Type(token.m_Type), m_Word(std::move(token.m_Word)), m_Line(token.m_Line), m_Column(token.m_Column) {
+		: m_Type(token.m_Type), m_Word(token.m_Word), m_Line(token.m_Line), m_Column(token.m_Column), m_Atom(token.m_Atom) {
 		token.m_Type = TokenType::None;
 		token.m_Line = token.m_Column = 0;
+		token.m_Atom = NoAtom;
 	}
 
 	Token& Token::operator=(const Token& token) {
@@ -35,17 +147,20 @@ namespace ice {
 		m_Word = token.m_Word;
 		m_Line = token.m_Line;
 		m_Column = token.m_Column;
+		m_Atom = token.m_Atom;
 
 		return *this;
 	}
 	Token& Token::operator=(Token&& token) noexcept {
 		m_Type = token.m_Type;
-		m_Word = std::move(token.m_Word);
+		m_Word = token.m_Word;
 		m_Line = token.m_Line;
 		m_Column = token.m_Column;
+		m_Atom = token.m_Atom;
 
 		token.m_Type = TokenType::None;
 		token.m_Line = token.m_Column = 0;
+		token.m_Atom = NoAtom;
 
 		return *this;
 	}
@@ -56,11 +171,11 @@ namespace ice {
 	void Token::Type(TokenType newType) noexcept {
 		m_Type = newType;
 	}
-	std::string Token::Word() const {
+	std::string_view Token::Word() const noexcept {
 		return m_Word;
 	}
-	void Token::Word(std::string newWord) noexcept {
-		m_Word = std::move(newWord);
+	void Token::Word(std::string_view newWord) noexcept {
+		m_Word = newWord;
 	}
 	std::size_t Token::Line() const noexcept {
 		return m_Line;
@@ -74,224 +189,366 @@ namespace ice {
 	void Token::Column(std::size_t newColumn) noexcept {
 		m_Column = newColumn;
 	}
+	ice::Atom Token::Atom() const noexcept {
+		return m_Atom;
+	}
+	void Token::Atom(ice::Atom newAtom) noexcept {
+		m_Atom = newAtom;
+	}
 
 	std::string Token::ToString() const {
 		std::ostringstream oss;
-		oss << m_Line << ':' << m_Column + 1 << ": " << m_TypeNames.at(m_Type) << "(\"" << m_Word << "\")";
+		oss << m_Line << ':' << m_Column + 1 << ": " << s_TokenTypeNames[ToIndex(m_Type)] << "(\"" << m_Word << "\")";
 		return oss.str();
 	}
 }
 
 namespace ice {
-	const std::unordered_map<std::string, TokenType> Lexer::m_Keywords = {
-#define EOrg(type1, type2, str) { str, TokenType::type1##type2 }
-#define E(type, str) EOrg(type, Keyword, str)
-		E(Module, "module"),
-		E(Import, "import"),
-		
-		E(Int8, "int8"),
-		E(Int16, "int16"),
-		E(Int32, "int32"),
-		E(Int64, "int64"),
-		E(Int128, "int128"),
-		E(IntPtr, "intptr"),
-		E(UInt8, "uint8"),
-		E(UInt16, "uint16"),
-		E(UInt32, "uint32"),
-		E(UInt64, "uint64"),
-		E(UInt128, "uint128"),
-		E(UIntPtr, "uintptr"),
-		E(Float32, "float32"),
-		E(Float64, "float64"),
-		E(Number, "number"),
-		E(Void, "void"),
-		E(Bool, "bool"),
-		E(True, "true"),
-		E(False, "false"),
-		E(Char, "char"),
-		E(Char8, "char8"),
-		E(String, "string"),
-		E(String8, "string8"),
-		E(Null, "null"),
-		E(Any, "any"),
-		E(Object, "object"),
-
-		E(Enum, "enum"),
-		E(Struct, "struct"),
-		E(LowerSelf, "self"),
-		E(UpperSelf, "Self"),
-		E(Trait, "trait"),
-		E(Impl, "impl"),
-		E(Pub, "pub"),
-		E(Priv, "priv"),
-		E(Is, "is"),
-		E(As, "as"),
-
-		E(Function, "function"),
-		E(Return, "return"),
-		E(Operator, "operator"),
-
-		E(If, "if"),
-		E(Else, "else"),
-		E(Switch, "switch"),
-		E(Case, "case"),
-		E(For, "for"),
-		E(While, "while"),
-		E(Do, "do"),
-		E(Break, "break"),
-		E(Continue, "continue"),
-
-		E(Var, "var"),
-		E(Let, "let"),
-		E(Mut, "mut"),
-		E(New, "new"),
-
-		E(Throw, "throw"),
-		E(Try, "try"),
-		E(Catch, "catch"),
-		E(Finally, "finally"),
-
-		E(SizeOf, "sizeof"),
-		E(TypeOf, "typeof"),
-#undef EOrg
-#undef E
-	};
-	const std::unordered_map<char, const std::array<TokenType, 5>> Lexer::m_Operators = {
-		{ '+', { TokenType::Plus, TokenType::Increment, TokenType::PlusAssign } },
-		{ '-', { TokenType::Minus, TokenType::Decrement, TokenType::MinusAssign, TokenType::None, TokenType::RightwardsArrow } },
-		{ '*', { TokenType::Multiply, TokenType::Exponent, TokenType::MultiplyAssign, TokenType::ExponentAssign } },
-		{ '/', { TokenType::Divide, TokenType::None, TokenType::DivideAssign } },
-		{ '%', { TokenType::Modulo, TokenType::None, TokenType::ModuloAssign } },
-		{ '=', { TokenType::Assign, TokenType::Equal, TokenType::Equal, TokenType::None, TokenType::RightwardsDoubleArrow } },
-		{ '!', { TokenType::Not, TokenType::None, TokenType::NotEqual } },
-		{ '>', { TokenType::Greater, TokenType::BitLeftShift, TokenType::GreaterEqual, TokenType::BitLeftShiftAssign } },
-		{ '<', { TokenType::Less, TokenType::BitRightShift, TokenType::LessEqual, TokenType::BitRightShiftAssign } },
-		{ '&', { TokenType::BitAnd, TokenType::And, TokenType::BitAndAssign } },
-		{ '|', { TokenType::BitOr, TokenType::Or, TokenType::BitOrAssign } },
-		{ '^', { TokenType::BitXor, TokenType::None, TokenType::BitXorAssign } },
-		{ '~', { TokenType::BitNot } },
-		{ '{', { TokenType::LeftBrace } },
-		{ '}', { TokenType::RightBrace } },
-		{ '(', { TokenType::LeftParen } },
-		{ ')', { TokenType::RightParen } },
-		{ '[', { TokenType::LeftBigParen } },
-		{ ']', { TokenType::RightBigParen } },
-		{ '.', { TokenType::Dot } },
-		{ ',', { TokenType::Comma } },
-		{ ';', { TokenType::Semicolon } },
-		{ ':', { TokenType::Colon } },
-		{ '?', { TokenType::Question } },
-	};
-	const std::unordered_map<TokenType, std::string> Lexer::m_OperatorWords = {
-#define E(type, str) { TokenType:: type, str }
-		E(Plus, "+"),
-		E(Increment, "++"),
-		E(PlusAssign, "+="),
-		E(Minus, "-"),
-		E(Decrement, "--"),
-		E(MinusAssign, "-="),
-		E(Multiply, "*"),
-		E(MultiplyAssign, "*="),
-		E(Divide, "/"),
-		E(DivideAssign, "/="),
-		E(Modulo, "%"),
-		E(ModuloAssign, "%="),
-		E(Exponent, "**"),
-		E(ExponentAssign, "**="),
-
-		E(Assign, "="),
-		E(Equal, "=="),
-		E(NotEqual, "!="),
-		E(Greater, ">"),
-		E(GreaterEqual, ">="),
-		E(Less, "<"),
-		E(LessEqual, "<="),
-		E(And, "&&"),
-		E(Or, "||"),
-		E(Not, "!"),
-
-		E(BitAnd, "&"),
-		E(BitAndAssign, "&="),
-		E(BitOr, "|"),
-		E(BitOrAssign, "|="),
-		E(BitXor, "^"),
-		E(BitXorAssign, "^="),
-		E(BitNot, "~"),
-		E(BitLeftShift, "<<"),
-		E(BitLeftShiftAssign, "<<="),
-		E(BitRightShift, ">>"),
-		E(BitRightShiftAssign, ">>="),
-
-		E(RightwardsArrow, "->"),
-		E(RightwardsDoubleArrow, "=>"),
-
-		E(LeftBrace, "{"),
-		E(RightBrace, "}"),
-		E(LeftParen, "("),
-		E(RightParen, ")"),
-		E(LeftBigParen, "["),
-		E(RightBigParen, "]"),
-
-		E(Dot, "."),
-		E(Comma, ","),
-		E(Semicolon, ";"),
-		E(Colon, ":"),
-		E(Question, "?"),
-#undef E
-	};
-	
+	TokenBuffer::TokenBuffer(const TokenBuffer& tokenBuffer)
+		: m_Source(tokenBuffer.m_Source), m_FirstLine(tokenBuffer.m_FirstLine), m_Types(tokenBuffer.m_Types),
+		m_Offsets(tokenBuffer.m_Offsets), m_Lengths(tokenBuffer.m_Lengths), m_LineBegins(tokenBuffer.m_LineBegins), m_Atoms(tokenBuffer.m_Atoms) {
+	}
+	TokenBuffer::TokenBuffer(TokenBuffer&& tokenBuffer) noexcept
+		: m_Source(tokenBuffer.m_Source), m_FirstLine(tokenBuffer.m_FirstLine), m_Types(std::move(tokenBuffer.m_Types)),
+		m_Offsets(std::move(tokenBuffer.m_Offsets)), m_Lengths(std::move(tokenBuffer.m_Lengths)), m_LineBegins(std::move(tokenBuffer.m_LineBegins)),
+		m_Atoms(std::move(tokenBuffer.m_Atoms)) {
+		tokenBuffer.m_Source = {};
+		tokenBuffer.m_FirstLine = 1;
+	}
+
+	TokenBuffer& TokenBuffer::operator=(const TokenBuffer& tokenBuffer) {
+		m_Source = tokenBuffer.m_Source;
+		m_FirstLine = tokenBuffer.m_FirstLine;
+		m_Types = tokenBuffer.m_Types;
+		m_Offsets = tokenBuffer.m_Offsets;
+		m_Lengths = tokenBuffer.m_Lengths;
+		m_LineBegins = tokenBuffer.m_LineBegins;
+		m_Atoms = tokenBuffer.m_Atoms;
+
+		return *this;
+	}
+	TokenBuffer& TokenBuffer::operator=(TokenBuffer&& tokenBuffer) noexcept {
+		m_Source = tokenBuffer.m_Source;
+		m_FirstLine = tokenBuffer.m_FirstLine;
+		m_Types = std::move(tokenBuffer.m_Types);
+		m_Offsets = std::move(tokenBuffer.m_Offsets);
+		m_Lengths = std::move(tokenBuffer.m_Lengths);
+		m_LineBegins = std::move(tokenBuffer.m_LineBegins);
+		m_Atoms = std::move(tokenBuffer.m_Atoms);
+
+		tokenBuffer.m_Source = {};
+		tokenBuffer.m_FirstLine = 1;
+
+		return *this;
+	}
+	Token TokenBuffer::operator[](std::size_t index) const noexcept {
+		const std::size_t lineIndex = FindLine(m_Offsets[index]) - m_FirstLine;
+		return Token(m_Types[index], Word(index), m_FirstLine + lineIndex, m_Offsets[index] - m_LineBegins[lineIndex], Atom(index));
+	}
+
+	void TokenBuffer::Clear() noexcept {
+		m_Types.clear();
+		m_Offsets.clear();
+		m_Lengths.clear();
+		m_LineBegins.clear();
+		m_Atoms.clear();
+	}
+	void TokenBuffer::Reset(std::string_view source, std::size_t firstLine) noexcept {
+		Clear();
+
+		m_Source = source;
+		m_FirstLine = firstLine;
+	}
+	void TokenBuffer::Reserve(std::size_t tokenCount, std::size_t lineCount) {
+		m_Types.reserve(tokenCount);
+		m_Offsets.reserve(tokenCount);
+		m_Lengths.reserve(tokenCount);
+		m_LineBegins.reserve(lineCount);
+	}
+	bool TokenBuffer::IsEmpty() const noexcept {
+		return m_Types.empty();
+	}
+	std::size_t TokenBuffer::Size() const noexcept {
+		return m_Types.size();
+	}
+	std::string_view TokenBuffer::Source() const noexcept {
+		return m_Source;
+	}
+	void TokenBuffer::Source(std::string_view newSource) noexcept {
+		m_Source = newSource;
+	}
+	std::size_t TokenBuffer::FirstLine() const noexcept {
+		return m_FirstLine;
+	}
+	std::size_t TokenBuffer::LineCount() const noexcept {
+		return m_LineBegins.size();
+	}
+	std::size_t TokenBuffer::FindLine(std::size_t offset) const noexcept {
+		const auto iter = std::upper_bound(m_LineBegins.begin(), m_LineBegins.end(), offset);
+		return m_FirstLine + (iter - m_LineBegins.begin()) - 1;
+	}
+
+	TokenType TokenBuffer::Type(std::size_t index) const noexcept {
+		return m_Types[index];
+	}
+	std::string_view TokenBuffer::Word(std::size_t index) const noexcept {
+		return m_Source.substr(m_Offsets[index], m_Lengths[index]);
+	}
+	std::size_t TokenBuffer::Offset(std::size_t index) const noexcept {
+		return m_Offsets[index];
+	}
+	std::size_t TokenBuffer::Line(std::size_t index) const noexcept {
+		return FindLine(m_Offsets[index]);
+	}
+	std::size_t TokenBuffer::Column(std::size_t index) const noexcept {
+		return m_Offsets[index] - m_LineBegins[Line(index) - m_FirstLine];
+	}
+	ice::Atom TokenBuffer::Atom(std::size_t index) const noexcept {
+		return m_Atoms.empty() ? NoAtom : m_Atoms[index];
+	}
+	bool TokenBuffer::HasAtoms() const noexcept {
+		return m_Atoms.size() == m_Types.size();
+	}
+	const std::vector<TokenType>& TokenBuffer::Types() const noexcept {
+		return m_Types;
+	}
+	const std::vector<std::uint32_t>& TokenBuffer::Offsets() const noexcept {
+		return m_Offsets;
+	}
+	const std::vector<std::uint32_t>& TokenBuffer::Lengths() const noexcept {
+		return m_Lengths;
+	}
+	const std::vector<std::uint32_t>& TokenBuffer::LineBegins() const noexcept {
+		return m_LineBegins;
+	}
+	const std::vector<ice::Atom>& TokenBuffer::Atoms() const noexcept {
+		return m_Atoms;
+	}
+
+	void TokenBuffer::Add(TokenType type, std::size_t offset, std::size_t length) {
+		m_Types.push_back(type);
+		m_Offsets.push_back(static_cast<std::uint32_t>(offset));
+		m_Lengths.push_back(static_cast<std::uint32_t>(length));
+	}
+	void TokenBuffer::Add(TokenType type, std::size_t offset, std::size_t length, ice::Atom atom) {
+		Add(type, offset, length);
+		m_Atoms.push_back(atom);
+	}
+	void TokenBuffer::AddLine(std::size_t offset) {
+		m_LineBegins.push_back(static_cast<std::uint32_t>(offset));
+	}
+	void TokenBuffer::Append(const TokenBuffer& tokenBuffer) {
+		const bool hasAtoms = m_Atoms.size() == m_Types.size() && tokenBuffer.m_Atoms.size() == tokenBuffer.m_Types.size();
+
+		m_Types.insert(m_Types.end(), tokenBuffer.m_Types.begin(), tokenBuffer.m_Types.end());
+		m_Offsets.insert(m_Offsets.end(), tokenBuffer.m_Offsets.begin(), tokenBuffer.m_Offsets.end());
+		m_Lengths.insert(m_Lengths.end(), tokenBuffer.m_Lengths.begin(), tokenBuffer.m_Lengths.end());
+		m_LineBegins.insert(m_LineBegins.end(), tokenBuffer.m_LineBegins.begin(), tokenBuffer.m_LineBegins.end());
+		if (hasAtoms) {
+			m_Atoms.insert(m_Atoms.end(), tokenBuffer.m_Atoms.begin(), tokenBuffer.m_Atoms.end());
+		} else {
+			m_Atoms.clear();
+		}
+	}
+	void TokenBuffer::Append(const TokenBuffer& tokenBuffer, std::size_t offset) {
+		const bool hasAtoms = m_Atoms.size() == m_Types.size() && tokenBuffer.m_Atoms.size() == tokenBuffer.m_Types.size();
+		const std::uint32_t delta = static_cast<std::uint32_t>(offset);
+
+		m_Types.insert(m_Types.end(), tokenBuffer.m_Types.begin(), tokenBuffer.m_Types.end());
+		for (const std::uint32_t tokenOffset : tokenBuffer.m_Offsets) {
+			m_Offsets.push_back(tokenOffset + delta);
+		}
+		m_Lengths.insert(m_Lengths.end(), tokenBuffer.m_Lengths.begin(), tokenBuffer.m_Lengths.end());
+		for (const std::uint32_t lineBegin : tokenBuffer.m_LineBegins) {
+			m_LineBegins.push_back(lineBegin + delta);
+		}
+		if (hasAtoms) {
+			m_Atoms.insert(m_Atoms.end(), tokenBuffer.m_Atoms.begin(), tokenBuffer.m_Atoms.end());
+		} else {
+			m_Atoms.clear();
+		}
+	}
+	void TokenBuffer::Assign(std::string_view source, std::size_t firstLine, const TokenType* types, const std::uint32_t* offsets, const std::uint32_t* lengths,
+		const ice::Atom* atoms, std::size_t tokenCount, const std::uint32_t* lineBegins, std::size_t lineCount) {
+		m_Source = source;
+		m_FirstLine = firstLine;
+		m_Types.assign(types, types + tokenCount);
+		m_Offsets.assign(offsets, offsets + tokenCount);
+		m_Lengths.assign(lengths, lengths + tokenCount);
+		m_LineBegins.assign(lineBegins, lineBegins + lineCount);
+		if (atoms) {
+			m_Atoms.assign(atoms, atoms + tokenCount);
+		} else {
+			m_Atoms.clear();
+		}
+	}
+	void TokenBuffer::RemapAtoms(const std::vector<ice::Atom>& atoms) noexcept {
+		for (ice::Atom& atom : m_Atoms) {
+			if (atom != NoAtom) {
+				atom = atoms[atom];
+			}
+		}
+	}
+	void TokenBuffer::Intern(Interner& interner) {
+		m_Atoms.resize(m_Types.size());
+		for (std::size_t i = 0; i < m_Types.size(); ++i) {
+			if (m_Types[i] == TokenType::Identifer) {
+				m_Atoms[i] = interner.Intern(Word(i));
+			} else if (m_Types[i] >= TokenType::ModuleKeyword && m_Types[i] <= TokenType::TypeOfKeyword) {
+				m_Atoms[i] = Interner::GetKeywordAtom(m_Types[i]);
+			} else {
+				m_Atoms[i] = NoAtom;
+			}
+		}
+	}
+}
+
+namespace ice {
+	Lexer::Lexer(Interner& interner) noexcept
+		: m_Interner(&interner) {
+	}
 	Lexer::Lexer(Lexer&& lexer) noexcept
-		: m_Tokens(std::move(lexer.m_Tokens)) {
+		: m_Tokens(std::move(lexer.m_Tokens)), m_Interner(lexer.m_Interner) {
 	}
 
 	Lexer& Lexer::operator=(Lexer&& lexer) noexcept {
 		m_Tokens = std::move(lexer.m_Tokens);
+		m_Interner = lexer.m_Interner;
 
 		return *this;
 	}
 
 	void Lexer::Clear() noexcept {
-		m_Tokens.clear();
+		m_Tokens.Clear();
 	}
 	bool Lexer::IsEmpty() const noexcept {
-		return m_Tokens.empty();
+		return m_Tokens.IsEmpty();
 	}
-	std::vector<Token> Lexer::Tokens() noexcept {
+	TokenBuffer Lexer::Tokens() noexcept {
 		return std::move(m_Tokens);
 	}
 
-	bool Lexer::Lex(const std::string& sourceName, const std::string& source, Messages& messages) {
-		Clear();
+	bool Lexer::Lex(const std::string& sourceName, std::string_view source, Messages& messages) {
+		return LexLines(sourceName, source, source, messages, 1);
+	}
+	bool Lexer::LexParallel(const std::string& sourceName, std::string_view source, Messages& messages, ThreadPool& pool) {
+		const std::size_t chunkCount = std::min(pool.Size(), source.size() / s_ParallelChunkMinSize);
+		if (chunkCount <= 1) return Lex(sourceName, source, messages);
 
-		m_SourceName = &sourceName;
-		m_Messages = &messages;
+		std::vector<std::string_view> chunks;
+		std::size_t chunkBegin = 0;
+		for (std::size_t i = 1; i < chunkCount; ++i) {
+			const std::size_t chunkEnd = source.find('\n', std::max(chunkBegin, source.size() / chunkCount * i));
+			if (chunkEnd == std::string_view::npos) break;
+
+			chunks.push_back(source.substr(chunkBegin, chunkEnd - chunkBegin));
+			chunkBegin = chunkEnd + 1;
+		}
+		chunks.push_back(source.substr(chunkBegin));
+
+		std::vector<std::size_t> firstLines(chunks.size(), 1);
+		std::atomic<std::size_t> pendingCount = chunks.size() - 1;
+		for (std::size_t i = 1; i < chunks.size(); ++i) {
+			pool.Submit([&, i] {
+				const std::string_view chunk = chunks[i - 1];
+				firstLines[i] = static_cast<std::size_t>(std::count(chunk.begin(), chunk.end(), '\n')) + 1;
+				pendingCount.fetch_sub(1, std::memory_order_release);
+			});
+		}
+		pool.Wait(pendingCount);
+		for (std::size_t i = 1; i < chunks.size(); ++i) {
+			firstLines[i] += firstLines[i - 1];
+		}
+
+		std::vector<Lexer> lexers(chunks.size());
+		std::vector<Messages> chunkMessages(chunks.size());
+		std::vector<char> results(chunks.size());
+		pendingCount.store(chunks.size(), std::memory_order_relaxed);
+		for (std::size_t i = 0; i < chunks.size(); ++i) {
+			pool.Submit([&, i] {
+				results[i] = lexers[i].LexLines(sourceName, source, chunks[i], chunkMessages[i], firstLines[i]);
+				pendingCount.fetch_sub(1, std::memory_order_release);
+			});
+		}
+		pool.Wait(pendingCount);
+
+		const bool result = std::all_of(results.begin(), results.end(), [](char chunkResult) { return chunkResult != 0; });
+
+		std::size_t tokenCount = 0, lineCount = 0;
+		for (const Lexer& lexer : lexers) {
+			tokenCount += lexer.m_Tokens.Size();
+			lineCount += lexer.m_Tokens.LineCount();
+		}
 
-		std::size_t m_LineBegin = 0;
-		std::size_t nextLineBegin = source.find('\n');
+		m_Tokens.Reset(source, 1);
+		m_Tokens.Reserve(tokenCount, lineCount);
+		for (std::size_t i = 0; i < chunks.size(); ++i) {
+			m_Tokens.Append(lexers[i].m_Tokens);
+			messages.Merge(std::move(chunkMessages[i]));
+		}
+		if (m_Interner) {
+			m_Tokens.Intern(*m_Interner);
+		}
+		return result;
+	}
+
+	bool Lexer::LexLines(const std::string& sourceName, std::string_view source, std::string_view lines, Messages& messages, std::size_t firstLine) {
+		m_Tokens.Reset(source, firstLine);
+		Begin(sourceName, messages);
+		m_Line = firstLine;
+
+		if (source.size() > std::numeric_limits<std::uint32_t>::max()) {
+			messages.AddError(DiagnosticId::SourceTooLarge, messages.AddSource(sourceName));
+			return false;
+		}
+
+		ValidateLines(lines);
+
+		std::size_t lineBegin = 0;
+		std::size_t nextLineBegin = lines.find('\n');
 
 		do {
-			m_LineSource = source.substr(m_LineBegin, nextLineBegin - m_LineBegin);
-			if (!m_LineSource.empty() && m_LineSource.back() == '\r') {
-				m_LineSource.erase(m_LineSource.end() - 1);
-			}
-			
-			for (m_Column = 0; m_Column < m_LineSource.size(); m_Column += m_CharLength) {
-				m_Char = m_LineSource[m_Column];
-				m_CharLength = GetCodepointLength(m_Char);
-				if (!Next()) break;
-			}
+			LexLine(lines.substr(lineBegin, nextLineBegin - lineBegin));
+		} while ((lineBegin = nextLineBegin + 1,
+				  nextLineBegin = lines.find('\n', lineBegin),
+				  lineBegin) != 0);
 
-			AddIdentifier();
-			if (!m_IsNoEOLToken) {
-				m_Tokens.push_back(Token(TokenType::EOL, "", m_Line, m_LineSource.size()));
-				m_IsNoEOLToken = false;
+		return End();
+	}
+
+	void Lexer::Open(const std::string& sourceName, std::istream& stream, Messages& messages) {
+		Clear();
+		m_StreamSourceName = sourceName;
+		Begin(m_StreamSourceName, messages);
+
+		m_Stream = &stream;
+		m_StreamBuffer.clear();
+		m_StreamLineBegin = 0;
+		m_StreamTokenIndex = 0;
+		m_IsStreamEnd = false;
+	}
+	bool Lexer::NextToken(Token& token) {
+		while (m_StreamTokenIndex == m_Tokens.Size()) {
+			if (m_Stream == nullptr) return false;
+
+			m_StreamTokenIndex = 0;
+			if (!LexNextLine()) {
+				End();
+				m_Stream = nullptr;
+				return false;
 			}
-			++m_Line;
-			m_IsComment = false;
-		} while ((m_LineBegin = nextLineBegin + 1,
-				  nextLineBegin = source.find('\n', m_LineBegin),
-				  m_LineBegin) != 0);
+		}
+
+		token = m_Tokens[m_StreamTokenIndex++];
+		return true;
+	}
 
+	void Lexer::Begin(const std::string& sourceName, Messages& messages) {
+		m_SourceName = &sourceName;
+		m_Source = NoSource;
+		m_Messages = &messages;
+	}
+	bool Lexer::End() {
 		const bool result = !m_HasError;
 		m_Line = 1;
 		m_IsIdentifier = false;
@@ -300,69 +557,178 @@ namespace ice {
 
 		return result;
 	}
+	bool Lexer::LexNextLine() {
+		std::size_t searchBegin = m_StreamLineBegin;
+		std::size_t lineEnd;
+
+		while ((lineEnd = m_StreamBuffer.find('\n', searchBegin)) == std::string::npos) {
+			if (m_IsStreamEnd) {
+				if (m_StreamLineBegin > m_StreamBuffer.size()) return false;
+
+				const std::string_view line = std::string_view(m_StreamBuffer).substr(m_StreamLineBegin);
+				m_Tokens.Reset(m_StreamBuffer, m_Line);
+				ValidateLines(line);
+				LexLine(line);
+				m_StreamLineBegin = m_StreamBuffer.size() + 1;
+				return true;
+			}
+
+			m_StreamBuffer.erase(0, m_StreamLineBegin);
+			m_StreamLineBegin = 0;
+
+			const std::size_t oldSize = m_StreamBuffer.size();
+			m_StreamBuffer.resize(oldSize + s_StreamChunkSize);
+			m_Stream->read(m_StreamBuffer.data() + oldSize, s_StreamChunkSize);
+			m_StreamBuffer.resize(oldSize + static_cast<std::size_t>(m_Stream->gcount()));
+			m_IsStreamEnd = !*m_Stream;
+			searchBegin = oldSize;
+		}
+
+		const std::string_view line = std::string_view(m_StreamBuffer).substr(m_StreamLineBegin, lineEnd - m_StreamLineBegin);
+		m_Tokens.Reset(m_StreamBuffer, m_Line);
+		ValidateLines(line);
+		LexLine(line);
+		m_StreamLineBegin = lineEnd + 1;
+		return true;
+	}
+	void Lexer::ValidateLines(std::string_view lines) {
+		m_NonASCIILines.clear();
+		m_NonASCIILineIndex = 0;
+		m_InvalidSequences.clear();
+		m_InvalidSequenceIndex = 0;
+
+		const std::size_t offset = lines.data() - m_Tokens.Source().data();
+		std::size_t position = FindNonASCII(lines, 0);
+		const std::size_t firstNonASCII = position;
+		while (position < lines.size()) {
+			m_NonASCIILines.push_back(offset + position);
+			position = std::min(lines.find('\n', position), lines.size());
+			position = FindNonASCII(lines, position);
+		}
+
+		position = firstNonASCII;
+		while ((position = FindInvalidUTF8(lines, position)) < lines.size()) {
+			const std::size_t length = GetInvalidSequenceLength(lines, position);
+			m_InvalidSequences.emplace_back(offset + position, length);
+			position += length;
+		}
+	}
+	ISINLINE inline void Lexer::LexLine(std::string_view line) {
+		m_LineSource = line;
+		m_LineOffset = line.data() - m_Tokens.Source().data();
+		m_Tokens.AddLine(m_LineOffset);
+		if (!m_LineSource.empty() && m_LineSource.back() == '\r') {
+			m_LineSource.remove_suffix(1);
+		}
+
+		if (m_NonASCIILineIndex == m_NonASCIILines.size() || m_NonASCIILines[m_NonASCIILineIndex] >= m_LineOffset + line.size()) {
+			m_CharLength = 1;
+			for (m_Column = 0; m_Column < m_LineSource.size(); ++m_Column) {
+				m_Char = m_LineSource[m_Column];
+				if (!Next()) break;
+			}
+		} else {
+			++m_NonASCIILineIndex;
+
+			std::size_t invalidSequence = m_InvalidSequenceIndex;
+			while (m_InvalidSequenceIndex < m_InvalidSequences.size() && m_InvalidSequences[m_InvalidSequenceIndex].first < m_LineOffset + line.size()) {
+				const auto [offset, length] = m_InvalidSequences[m_InvalidSequenceIndex++];
+				AddError<DiagnosticId::InvalidUTF8Sequence>(offset - m_LineOffset, length);
+				m_HasError = true;
+			}
+
+			for (m_Column = 0; m_Column < m_LineSource.size(); m_Column += m_CharLength) {
+				m_Char = m_LineSource[m_Column];
+				m_CharLength = GetCodepointLength(m_Char);
+				if (m_CharLength != 1 && invalidSequence < m_InvalidSequenceIndex) {
+					while (invalidSequence < m_InvalidSequenceIndex && m_InvalidSequences[invalidSequence].first < m_LineOffset + m_Column) ++invalidSequence;
+					if (invalidSequence < m_InvalidSequenceIndex && m_InvalidSequences[invalidSequence].first == m_LineOffset + m_Column) {
+						m_CharLength = static_cast<int>(m_InvalidSequences[invalidSequence].second);
+					}
+				}
+				if (!Next()) break;
+			}
+		}
+
+		AddIdentifier();
+		if (!m_IsNoEOLToken) {
+			AddToken(TokenType::EOL, m_LineSource.size(), 0);
+		}
+		++m_Line;
+		m_IsNoEOLToken = false;
+		m_IsComment = false;
+	}
+
+	ISINLINE inline bool Lexer::Next() {
+		const CharInfo& info = s_CharTable[static_cast<unsigned char>(m_Char)];
+
+		switch (info.Class) {
+		case CharClass::Digit:
+			if (!m_IsIdentifier) {
+				LexInteger();
+				break;
+			}
+			[[fallthrough]];
 
-	ISINLINE bool Lexer::Next() {
-		if (!m_IsIdentifier && IsDigit(m_Char)) {
-			LexInteger();
-		} else if (m_Char == '"' || m_Char == '\'') {
+		case CharClass::Identifier:
+			if (!m_IsIdentifier) {
+				m_IsIdentifier = true;
+				m_IdentifierBegin = m_Column;
+			}
+			m_IdentifierEnd = SkipIdentifierCharacters(m_LineSource, m_Column + m_CharLength);
+			m_Column = m_IdentifierEnd - m_CharLength;
+			break;
+
+		case CharClass::Quotation:
 			AddIdentifier();
 			LexStringOrCharacter(m_Char);
-		} else if (IsWhitespace(m_Char)) {
+			break;
+
+		case CharClass::Whitespace:
 			AddIdentifier();
-		} else if (m_Char == '\\') {
+			m_Column = SkipWhitespaces(m_LineSource, m_Column + 1) - 1;
+			break;
+
+		case CharClass::Backslash:
 			AddIdentifier();
-			m_Messages->AddError("unexpected EOL", *m_SourceName, m_Line, m_Column,
-								 CreateMessageNoteLocation(m_LineSource, m_Line, m_Column, 1));
+			AddError<DiagnosticId::UnexpectedEOL>(m_Column, 1);
 			m_HasError = true;
-		} else if (m_Char == '\r') {
+			break;
+
+		case CharClass::CarriageReturn:
 			if (m_Column + 1 != m_LineSource.size()) {
 				AddIdentifier();
-				m_Messages->AddError("unexpected carriage return token", *m_SourceName, m_Line, m_Column);
-				m_Messages->AddNote("is the EOL in this source file a CR?", *m_SourceName);
+				m_Messages->AddError(DiagnosticId::UnexpectedCarriageReturn, SourceId(), m_Line, m_Column);
+				m_Messages->AddNote(DiagnosticId::CarriageReturnEOL);
 				m_HasError = true;
 			} else {
 				m_IsNoEOLToken = true;
 			}
-		} else {
-			if (LexSpecialCharacters()) {
-				switch (m_Char) {
-				case '`':
-				case '@':
-				case '#':
-				case '$':
-					AddIdentifier();
-					m_Messages->AddError("unexpected invalid token", *m_SourceName, m_Line, m_Column,
-										 CreateMessageNoteLocation(m_LineSource, m_Line, m_Column, 1));
-					m_HasError = true;
-					return true;
-				}
+			break;
 
-				if (m_IsIdentifier) {
-					m_IdentifierEnd += m_CharLength;
-				} else {
-					m_IsIdentifier = true;
-					m_IdentifierBegin = m_Column;
-					m_IdentifierEnd = m_Column + m_CharLength;
-				}
-			} else if (AddIdentifier() && m_Tokens.size() > 1) {
-				std::iter_swap(m_Tokens.end() - 1, m_Tokens.end() - 2);
-			}
+		case CharClass::Operator:
+			AddIdentifier();
+			LexOperator(info.Operators);
+			break;
+
+		case CharClass::Invalid:
+			AddIdentifier();
+			AddError<DiagnosticId::UnexpectedInvalidToken>(m_Column, 1);
+			m_HasError = true;
+			break;
 		}
 		return !m_IsComment;
 	}
 
-	ISINLINE bool Lexer::ReadDigits(std::size_t& end, bool(*digitChecker1)(char), bool(*digitChecker2)(char), const char* base) {
+	ISINLINE inline bool Lexer::ReadDigits(std::size_t& end, bool(*digitChecker1)(char), bool(*digitChecker2)(char), const char* base) {
 		bool hasError = false;
 		while (end < m_LineSource.size() &&
 			  (digitChecker1(m_LineSource[end]) || m_LineSource[end] == '\'')) {
 			if (!digitChecker2(m_LineSource[end])) {
-				m_Messages->AddError(Format("invalid digit '%' in % constant", { std::string(1, m_LineSource[end]), base }),
-									 *m_SourceName, m_Line, end,
-									 CreateMessageNoteLocation(m_LineSource, m_Line, end, 1));
+				AddError<DiagnosticId::InvalidDigit>(end, 1, m_LineSource[end], base);
 				hasError = true;
 			} else if (m_LineSource[end - 1] == '\'' && m_LineSource[end] == '\'') {
-				m_Messages->AddError("expected digit token after '\''", *m_SourceName, m_Line, end,
-									 CreateMessageNoteLocation(m_LineSource, m_Line, end, 1));
+				AddError<DiagnosticId::ExpectedDigit>(end, 1, '\'');
 				hasError = true;
 			}
 			++end;
@@ -371,35 +737,34 @@ namespace ice {
 			m_Column = end - 1;
 			return m_HasError = true;
 		} else if (m_LineSource[end - 1] == '\'') {
-			m_Messages->AddError("expected digit token after '\''", *m_SourceName, m_Line, end - 1,
-								 CreateMessageNoteLocation(m_LineSource, m_Line, end - 1, 1));
+			AddError<DiagnosticId::ExpectedDigit>(end - 1, 1, '\'');
 			m_Column = end - 1;
 			return m_HasError = true;
 		} else return false;
 	}
-	ISINLINE bool Lexer::ReadBinDigits(std::size_t& end) {
+	ISINLINE inline bool Lexer::ReadBinDigits(std::size_t& end) {
 		return ReadDigits(end, IsDigit, [](char c) {
 			return c <= '1';
 		}, "binary");
 	}
-	ISINLINE bool Lexer::ReadOctDigits(std::size_t& end) {
+	ISINLINE inline bool Lexer::ReadOctDigits(std::size_t& end) {
 		return ReadDigits(end, IsDigit, [](char c) {
 			return c <= '7';
 		}, "octal");
 	}
-	ISINLINE bool Lexer::ReadDecDigits(std::size_t& end) {
+	ISINLINE inline bool Lexer::ReadDecDigits(std::size_t& end) {
 		return ReadDigits(end, IsDigit, [](char) {
 			return true;
 		}, nullptr);
 	}
-	ISINLINE bool Lexer::ReadHexDigits(std::size_t& end) {
+	ISINLINE inline bool Lexer::ReadHexDigits(std::size_t& end) {
 		return ReadDigits(end, [](char c) {
 			return IsDigit(c) || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
 		}, [](char) {
 			return true;
 		}, nullptr);
 	}
-	ISINLINE bool Lexer::ReadScientificNotation(std::size_t& end) {
+	ISINLINE inline bool Lexer::ReadScientificNotation(std::size_t& end) {
 		if (end == m_LineSource.size() || (m_LineSource[end] != 'e' && m_LineSource[end] != 'E')) return false;
 		else if (end + 1 < m_LineSource.size()) {
 			const std::size_t oldEnd = ++end;
@@ -408,58 +773,53 @@ namespace ice {
 				if (m_LineSource[oldEnd] == '+' || m_LineSource[oldEnd] == '-') {
 					return ReadDecDigits(++end);
 				} else {
-					m_Messages->AddError(Format("expected digit token after '%'", { std::string(1, m_LineSource[oldEnd]) }),
-										 *m_SourceName, m_Line, oldEnd,
-										 CreateMessageNoteLocation(m_LineSource, m_Line, oldEnd, 1));
+					const std::size_t length = std::max(GetValidCodepointLength(m_LineSource, oldEnd), 1);
+					AddError<DiagnosticId::ExpectedDigit>(oldEnd, length, MessageArgument::Span(oldEnd, length));
 					m_Column = end - 1;
 					return m_HasError = true;
 				}
 			} else return false;
 		} else {
-			m_Messages->AddError(Format("expected digit token after '%'", { std::string(1, m_LineSource[end]) }),
-								 *m_SourceName, m_Line, end,
-								 CreateMessageNoteLocation(m_LineSource, m_Line, end, 1));
+			AddError<DiagnosticId::ExpectedDigit>(end, 1, m_LineSource[end]);
 			m_Column = end - 1;
 			return m_HasError = true;
 		}
 	}
 	
-	ISINLINE void Lexer::LexInteger() {
+	ISINLINE inline void Lexer::LexInteger() {
 		if (m_LineSource[m_Column] != '0') {
 			LexDecIntegerOrDecimal();
 		} else {
 			LexOtherIntegers();
 		}
 	}
-	ISINLINE void Lexer::LexDecIntegerOrDecimal() {
+	ISINLINE inline void Lexer::LexDecIntegerOrDecimal() {
 		std::size_t endColumn = m_Column + 1;
 		if (ReadDecDigits(endColumn)) return;
 		else if (endColumn < m_LineSource.size() && m_LineSource[endColumn] == '.') {
 			const std::size_t oldEndColumn = ++endColumn;
 			if (ReadDecDigits(endColumn)) return;
 			else if (oldEndColumn == endColumn) {
-				m_Messages->AddError("expected digit token after '.'", *m_SourceName, m_Line, endColumn - 1,
-									 CreateMessageNoteLocation(m_LineSource, m_Line, endColumn - 1, 1));
+				AddError<DiagnosticId::ExpectedDigit>(endColumn - 1, 1, '.');
 				m_HasError = true;
 				if (m_LineSource[endColumn] == 'e' || m_LineSource[endColumn] == 'E') {
 					++endColumn;
 					ReadDecDigits(endColumn);
 				}
 			} else if (!ReadScientificNotation(endColumn)) {
-				m_Tokens.push_back(Token(TokenType::Decimal, m_LineSource.substr(m_Column, endColumn - m_Column), m_Line, m_Column));
+				AddToken(TokenType::Decimal, m_Column, endColumn - m_Column);
 			}
 		} else {
 			const std::size_t oldEndColumn = endColumn;
 			if (!ReadScientificNotation(endColumn)) {
-				m_Tokens.push_back(Token(endColumn == oldEndColumn ? TokenType::DecInteger : TokenType::Decimal,
-								   m_LineSource.substr(m_Column, endColumn - m_Column), m_Line, m_Column));
+				AddToken(endColumn == oldEndColumn ? TokenType::DecInteger : TokenType::Decimal, m_Column, endColumn - m_Column);
 			}
 		}
 		m_Column = endColumn - 1;
 	}
-	ISINLINE void Lexer::LexOtherIntegers() {
+	ISINLINE inline void Lexer::LexOtherIntegers() {
 		if (m_Column + 1 == m_LineSource.size()) {
-			m_Tokens.push_back(Token(TokenType::DecInteger, "0", m_Line, m_Column));
+			AddToken(TokenType::DecInteger, m_Column, 1);
 			return;
 		}
 
@@ -504,24 +864,21 @@ namespace ice {
 				ReadScientificNotation(endColumn);
 			} else if (oldEndColumn == endColumn) goto done;
 
-			m_Messages->AddError(Format("invalid suffix '%' in integer constant", { m_LineSource.substr(oldEndColumn, endColumn - oldEndColumn) }),
-								 *m_SourceName, m_Line, oldEndColumn,
-								 CreateMessageNoteLocation(m_LineSource, m_Line, oldEndColumn, endColumn - oldEndColumn));
+			AddError<DiagnosticId::InvalidIntegerSuffix>(oldEndColumn, endColumn - oldEndColumn, MessageArgument::Span(oldEndColumn, endColumn - oldEndColumn));
 			m_Column = endColumn - 1;
 			m_HasError = true;
 		} else {
 		done:
-			m_Tokens.push_back(Token(base, m_LineSource.substr(m_Column, endColumn - m_Column), m_Line, m_Column));
+			AddToken(base, m_Column, endColumn - m_Column);
 			m_Column = endColumn - 1;
 		}
 	}
-	ISINLINE void Lexer::LexStringOrCharacter(char quotation) {
+	ISINLINE inline void Lexer::LexStringOrCharacter(char quotation) {
 		std::size_t endColumn = m_Column + 1;
 		do {
-			while (endColumn < m_LineSource.size() && m_LineSource[endColumn] != quotation) ++endColumn;
+			endColumn = FindCharacter(m_LineSource, endColumn, quotation);
 			if (endColumn == m_LineSource.size()) {
-				m_Messages->AddError("unexcpeted EOL", *m_SourceName, m_Line, endColumn - 1,
-									 CreateMessageNoteLocation(m_LineSource, m_Line, endColumn - 1, 1));
+				AddError<DiagnosticId::UnterminatedLiteral>(endColumn - 1, 1);
 				m_Column = endColumn - 1;
 				m_HasError = true;
 				return;
@@ -529,42 +886,61 @@ namespace ice {
 			++endColumn;
 		} while (m_LineSource[endColumn - 2] == '\\');
 
-		m_Tokens.push_back(Token(quotation == '"' ? TokenType::String : TokenType::Character, m_LineSource.substr(m_Column, endColumn - m_Column), m_Line, m_Column));
+		AddToken(quotation == '"' ? TokenType::String : TokenType::Character, m_Column, endColumn - m_Column);
 		m_Column = endColumn - 1;
 	}
-	ISINLINE bool Lexer::LexSpecialCharacters() {
-		const auto iter = m_Operators.find(m_Char);
-		if (iter == m_Operators.end()) return true;
-
+	ISINLINE inline void Lexer::LexOperator(const std::array<TokenType, 5>& operators) {
 		int index = 0;
 		std::size_t column = m_Column + 1;
 		if (column < m_LineSource.size()) {
 			const char nextChar = m_LineSource[column];
-			if (m_Char == nextChar) {
+			if (m_Char == nextChar && operators[1] != TokenType::None) {
 				if (++column < m_LineSource.size() && m_LineSource[column] == '=' &&
-					iter->second[3] != TokenType::None) {
+					operators[3] != TokenType::None) {
 					index = 3;
 					++column;
-				} else if (iter->second[1] != TokenType::None) {
+				} else {
 					index = 1;
 				}
-			} else if (nextChar == '=' && iter->second[2] != TokenType::None) ++column, index = 2;
-			  else if (nextChar == '>' && iter->second[4] != TokenType::None) ++column, index = 4;
+			} else if (nextChar == '=' && operators[2] != TokenType::None) ++column, index = 2;
+			  else if (nextChar == '>' && operators[4] != TokenType::None) ++column, index = 4;
 		}
 
-		m_Tokens.push_back(Token(iter->second[index], m_OperatorWords.at(iter->second[index]), m_Line, m_Column));
+		AddToken(operators[index], m_Column, column - m_Column);
 		m_Column = column - 1;
-		return false;
 	}
-	ISINLINE bool Lexer::AddIdentifier() {
+	ISINLINE inline void Lexer::AddToken(TokenType type, std::size_t column, std::size_t length, ice::Atom atom) {
+		length = std::min(length, m_LineSource.size() - column);
+		if (m_Interner) {
+			m_Tokens.Add(type, m_LineOffset + column, length, atom);
+		} else {
+			m_Tokens.Add(type, m_LineOffset + column, length);
+		}
+	}
+	ISINLINE inline bool Lexer::AddIdentifier() {
 		if (!m_IsIdentifier) return false;
 
 		m_IsIdentifier = false;
-		m_Tokens.push_back(Token(TokenType::Identifer, m_LineSource.substr(m_IdentifierBegin, m_IdentifierEnd - m_IdentifierBegin),
-								 m_Line, m_IdentifierBegin));
-		if (auto iter = m_Keywords.find(m_Tokens.back().Word()); iter != m_Keywords.end()) {
-			m_Tokens.back().Type(iter->second);
+
+		const std::string_view word = m_LineSource.substr(m_IdentifierBegin, m_IdentifierEnd - m_IdentifierBegin);
+		if (m_Interner) {
+			const ice::Atom atom = m_Interner->Intern(word);
+			AddToken(Interner::IsKeyword(atom) ? Interner::GetKeyword(atom) : TokenType::Identifer, m_IdentifierBegin, word.size(), atom);
+		} else {
+			const TokenType keyword = FindKeyword(word);
+			AddToken(keyword != TokenType::None ? keyword : TokenType::Identifer, m_IdentifierBegin, word.size());
 		}
 		return true;
 	}
+
+	std::uint32_t Lexer::SourceId() {
+		if (m_Source == NoSource) {
+			m_Source = m_Messages->AddSource(*m_SourceName);
+		}
+		return m_Source;
+	}
+	template<DiagnosticId Id, typename... Arguments>
+	void Lexer::AddError(std::size_t column, std::size_t length, const Arguments&... arguments) {
+		m_Messages->AddError<Id>(SourceId(), m_Line, column, length, m_LineSource, arguments...);
+	}
 }
\ No newline at end of file
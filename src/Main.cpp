@@ -1,32 +1,390 @@
+#include <ice/Cache.hpp>
+#include <ice/DiagnosticEngine.hpp>
+#include <ice/DiagnosticSink.hpp>
+#include <ice/Driver.hpp>
+#include <ice/File.hpp>
+#include <ice/Interner.hpp>
 #include <ice/Lexer.hpp>
+#include <ice/Parser.hpp>
+#include <ice/ast/Dumper.hpp>
+#include <ice/ast/Tree.hpp>
 
-#include <Windows.h>
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <Windows.h>
+#endif
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <chrono>
+#include <cstddef>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
-int main(int argc, char* argv[]) {
-	SetConsoleOutputCP(CP_UTF8);
+namespace {
+	enum class DiagnosticFormat {
+		Terminal,
+		Json,
+		Count,
+	};
 
-	// Test and Benchmark Codes
-	auto test = u8"0 0.5 0e5 0e+5 0e-5 0.0e5";
-	auto lexer = ice::Lexer();
-	auto messages = ice::Messages();
+	struct Options final {
+		bool DumpTokens = false;
+		bool Parse = false;
+		bool DumpAST = false;
+		bool Stats = false;
+		bool Build = false;
+		bool Cache = false;
+		std::string CacheDirectory;
+		DiagnosticFormat Diagnostics = DiagnosticFormat::Terminal;
+		std::size_t Jobs = 0;
+		std::vector<std::string> Paths;
+	};
 
-	std::cout << "<Test Code>\n" << test << "\n\n\n";
+	struct Statistics final {
+		bool IsMapped = false;
+		bool IsCached = false;
+		std::size_t Bytes = 0;
+		std::size_t Tokens = 0;
+		std::size_t Atoms = 0;
+		std::size_t Nodes = 0;
+		double Seconds = 0.0;
+	};
 
-	auto pointLexingBegin = std::chrono::high_resolution_clock::now();
-	lexer.Lex("", test, messages);
-	auto pointLexingEnd = std::chrono::high_resolution_clock::now();
-	auto timeLexing = (pointLexingEnd - pointLexingBegin).count() / 1000;
+	bool ParseOptions(int argc, char* argv[], Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view argument = argv[i];
+			if (argument == "--dump-tokens") {
+				options.DumpTokens = true;
+			} else if (argument == "--parse") {
+				options.Parse = true;
+			} else if (argument == "--dump-ast") {
+				options.Parse = true;
+				options.DumpAST = true;
+			} else if (argument == "--build") {
+				options.Parse = true;
+				options.Build = true;
+			} else if (argument == "--stats") {
+				options.Stats = true;
+			} else if (argument == "--cache") {
+				options.Parse = true;
+				options.Cache = true;
+				options.CacheDirectory.clear();
+			} else if (argument.substr(0, 8) == "--cache=") {
+				options.Parse = true;
+				options.Cache = true;
+				options.CacheDirectory = argument.substr(8);
+				if (options.CacheDirectory.empty()) {
+					std::cerr << "error: empty cache directory\n";
+					return false;
+				}
+			} else if (argument == "--diagnostics=terminal") {
+				options.Diagnostics = DiagnosticFormat::Terminal;
+			} else if (argument == "--diagnostics=json") {
+				options.Diagnostics = DiagnosticFormat::Json;
+			} else if (argument == "--diagnostics=count") {
+				options.Diagnostics = DiagnosticFormat::Count;
+			} else if (argument.substr(0, 7) == "--jobs=") {
+				const std::string_view jobs = argument.substr(7);
+				const auto [end, error] = std::from_chars(jobs.data(), jobs.data() + jobs.size(), options.Jobs);
+				if (error != std::errc() || end != jobs.data() + jobs.size() || options.Jobs == 0) {
+					std::cerr << "error: invalid job count '" << jobs << "'\n";
+					return false;
+				}
+			} else if (argument.size() > 2 && argument.substr(0, 2) == "--") {
+				std::cerr << "error: unknown option '" << argument << "'\n";
+				return false;
+			} else {
+				options.Paths.push_back(argv[i]);
+			}
+		}
 
-	std::cout << "<Lexing>\n" << timeLexing << "micro-seconds\nResult:\n";
-	auto tokens = lexer.Tokens();
-	for (const auto& token : tokens) {
-		std::cout << token.ToString() << '\n';
+		if (options.Paths.empty()) {
+			std::cerr << "usage: " << (argc > 0 ? argv[0] : "IceScript")
+					  << " [--dump-tokens] [--parse] [--dump-ast] [--build] [--cache[=<directory>]] [--stats] [--diagnostics=terminal|json|count] [--jobs=<count>] <file|->...\n";
+			return false;
+		} else if (options.DumpTokens && options.Jobs != 0) {
+			std::cerr << "error: '--dump-tokens' cannot be used with '--jobs'\n";
+			return false;
+		} else if (options.DumpAST && options.Jobs != 0) {
+			std::cerr << "error: '--dump-ast' cannot be used with '--jobs'\n";
+			return false;
+		} else if (options.Build && (options.DumpTokens || options.DumpAST)) {
+			std::cerr << "error: '--build' cannot be used with '--dump-tokens' or '--dump-ast'\n";
+			return false;
+		} else if (options.Build && std::find(options.Paths.begin(), options.Paths.end(), "-") != options.Paths.end()) {
+			std::cerr << "error: '--build' cannot read from standard input\n";
+			return false;
+		} else return true;
 	}
-	std::cout << "\nMessages:\n";
-	messages.Print();
 
-	return 0;
+	std::unique_ptr<ice::DiagnosticSink> CreateDiagnosticSink(DiagnosticFormat format) {
+		switch (format) {
+		case DiagnosticFormat::Json:
+			return std::make_unique<ice::JsonDiagnosticSink>(std::cout);
+
+		case DiagnosticFormat::Count:
+			return std::make_unique<ice::CountingDiagnosticSink>();
+
+		default:
+			return std::make_unique<ice::TerminalDiagnosticSink>(std::cout);
+		}
+	}
+
+	void DumpToken(const ice::Token& token, const Options& options) {
+		if (options.DumpTokens) {
+			std::cout << token.ToString() << '\n';
+		}
+	}
+
+	bool LexMappedFile(const std::string& path, std::string_view source, const Options& options, ice::Interner& interner, ice::Messages& messages,
+					   Statistics& statistics) {
+		const ice::CompilationCache cache(options.CacheDirectory);
+		ice::TokenBuffer tokens;
+		ice::ast::Tree tree;
+		bool result = true;
+
+		const auto begin = std::chrono::steady_clock::now();
+		if (options.Cache && cache.Load(path, source, interner, tokens, tree)) {
+			statistics.IsCached = true;
+		} else {
+			ice::Lexer lexer(interner);
+			result = lexer.Lex(path, source, messages);
+			tokens = lexer.Tokens();
+
+			if (options.Parse) {
+				ice::Parser parser(interner);
+				result = parser.Parse(path, tokens, tree, messages) && result;
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		if (options.Cache && !statistics.IsCached && messages.ErrorCount() == 0 && messages.WarningCount() == 0) {
+			cache.Store(path, source, interner, tokens, tree);
+		}
+
+		if (options.DumpTokens) {
+			for (std::size_t i = 0; i < tokens.Size(); ++i) {
+				DumpToken(tokens[i], options);
+			}
+		}
+		if (options.DumpAST) {
+			ice::ast::TextDumper dumper(std::cout, interner);
+			dumper.Tokens(&tokens);
+			dumper.Dump(tree);
+		}
+
+		statistics.IsMapped = true;
+		statistics.Bytes = source.size();
+		statistics.Tokens = tokens.Size();
+		statistics.Nodes = tree.Size();
+		statistics.Seconds = std::chrono::duration<double>(end - begin).count();
+		return result;
+	}
+	bool LexStream(const std::string& path, std::istream& stream, const Options& options, ice::Interner& interner, ice::Messages& messages,
+				   Statistics& statistics) {
+		ice::Lexer lexer(interner);
+		ice::Token token;
+
+		const auto begin = std::chrono::steady_clock::now();
+		lexer.Open(path, stream, messages);
+		if (options.Parse) {
+			ice::Parser parser(interner);
+			ice::ast::Tree tree;
+			parser.Parse(path, lexer, tree, messages);
+
+			if (options.DumpAST) {
+				ice::ast::TextDumper(std::cout, interner).Dump(tree);
+			}
+			statistics.Tokens = parser.TokenCount();
+			statistics.Nodes = tree.Size();
+		} else {
+			while (lexer.NextToken(token)) {
+				DumpToken(token, options);
+				++statistics.Tokens;
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		statistics.Seconds = std::chrono::duration<double>(end - begin).count();
+		return !messages.HasErrors();
+	}
+
+	bool LexPath(const std::string& path, const Options& options, ice::Interner& interner, ice::Messages& messages, Statistics& statistics, bool& result) {
+		if (path == "-") {
+			result = LexStream(path, std::cin, options, interner, messages, statistics);
+		} else if (ice::MappedFile file; file.Open(path)) {
+			result = LexMappedFile(path, file.Data(), options, interner, messages, statistics);
+		} else if (std::ifstream stream(path, std::ios::binary); stream) {
+			result = LexStream(path, stream, options, interner, messages, statistics);
+		} else return false;
+
+		statistics.Atoms = interner.Size();
+		return true;
+	}
+
+	void PrintStatistics(const std::string& path, const Statistics& statistics, bool hasErrors) {
+		std::cout << path << ": ";
+		if (statistics.IsMapped) {
+			std::cout << statistics.Bytes << " bytes, ";
+		}
+		std::cout << statistics.Tokens << " tokens, ";
+		if (statistics.Nodes != 0) {
+			std::cout << statistics.Nodes << " nodes, ";
+		}
+		std::cout << statistics.Atoms << " atoms, " << (hasErrors ? "with" : "no") << " errors, ";
+		if (statistics.IsCached) {
+			std::cout << "cached, ";
+		}
+		std::cout << statistics.Seconds * 1000.0 << " ms";
+		if (statistics.IsMapped && statistics.Seconds > 0.0) {
+			std::cout << " (" << statistics.Bytes / statistics.Seconds / (1024.0 * 1024.0) << " MiB/s)";
+		}
+		std::cout << '\n';
+	}
+
+	bool LexSequentially(const Options& options, ice::DiagnosticSink& sink) {
+		ice::Interner interner;
+		ice::DiagnosticEngine engine;
+		bool isSucceeded = true;
+		for (const std::string& path : options.Paths) {
+			Statistics statistics;
+			bool result;
+
+			if (!LexPath(path, options, interner, engine.Open(), statistics, result)) {
+				std::cerr << "error: cannot open '" << path << "'\n";
+				isSucceeded = false;
+				continue;
+			}
+
+			engine.Print(sink);
+			if (options.Stats) {
+				PrintStatistics(path, statistics, !result);
+			}
+			isSucceeded &= result;
+		}
+
+		return isSucceeded;
+	}
+	bool LexConcurrently(const Options& options, ice::DiagnosticSink& sink) {
+		ice::DiagnosticEngine engine;
+		std::vector<Statistics> statistics(options.Paths.size());
+		std::vector<char> results(options.Paths.size()), isOpened(options.Paths.size());
+		std::vector<ice::Messages*> messages(options.Paths.size());
+		std::atomic<std::size_t> nextPath = 0;
+
+		for (std::size_t i = 0; i < options.Paths.size(); ++i) {
+			messages[i] = &engine.Open();
+		}
+
+		const auto worker = [&] {
+			std::size_t index;
+			while ((index = nextPath.fetch_add(1, std::memory_order_relaxed)) < options.Paths.size()) {
+				ice::Interner interner;
+				bool result = false;
+				isOpened[index] = LexPath(options.Paths[index], options, interner, *messages[index], statistics[index], result);
+				results[index] = result;
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (std::size_t i = 1; i < std::min(options.Jobs, options.Paths.size()); ++i) {
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		engine.Print(sink);
+
+		bool isSucceeded = true;
+		for (std::size_t i = 0; i < options.Paths.size(); ++i) {
+			if (!isOpened[i]) {
+				std::cerr << "error: cannot open '" << options.Paths[i] << "'\n";
+				isSucceeded = false;
+				continue;
+			}
+
+			if (options.Stats) {
+				PrintStatistics(options.Paths[i], statistics[i], !results[i]);
+			}
+			isSucceeded &= results[i] != 0;
+		}
+
+		return isSucceeded;
+	}
+	bool BuildModules(const Options& options, ice::DiagnosticSink& sink) {
+		const ice::CompilationCache cache(options.CacheDirectory);
+		ice::Driver driver(options.Jobs != 0 ? options.Jobs : std::max(std::thread::hardware_concurrency(), 1u));
+		if (options.Cache) {
+			driver.Cache(&cache);
+		}
+		for (const std::string& path : options.Paths) {
+			driver.Add(path);
+		}
+
+		ice::DiagnosticEngine engine;
+		const auto begin = std::chrono::steady_clock::now();
+		bool isSucceeded = driver.Build(engine);
+		const auto end = std::chrono::steady_clock::now();
+
+		engine.Print(sink);
+
+		Statistics total;
+		for (std::size_t i = 0; i < driver.Size(); ++i) {
+			const ice::Module& module = driver[i];
+			if (!module.IsOpened) {
+				std::cerr << "error: cannot open '" << module.Path << "'\n";
+				isSucceeded = false;
+				continue;
+			}
+
+			Statistics statistics;
+			statistics.IsMapped = true;
+			statistics.IsCached = module.IsCached;
+			statistics.Bytes = module.File.Data().size();
+			statistics.Tokens = module.Tokens.Size();
+			statistics.Atoms = module.Interner.Size();
+			statistics.Nodes = module.Tree.Size();
+			statistics.Seconds = module.Seconds;
+			if (options.Stats) {
+				PrintStatistics(module.Path, statistics, !module.IsSucceeded);
+			}
+
+			total.Bytes += statistics.Bytes;
+			total.Tokens += statistics.Tokens;
+			total.Atoms += statistics.Atoms;
+			total.Nodes += statistics.Nodes;
+		}
+
+		if (options.Stats) {
+			total.IsMapped = true;
+			total.Seconds = std::chrono::duration<double>(end - begin).count();
+			PrintStatistics("total (" + std::to_string(driver.Size()) + " modules, " + std::to_string(driver.JobCount()) + " jobs)", total, !isSucceeded);
+		}
+		return isSucceeded;
+	}
+}
+
+int main(int argc, char* argv[]) {
+#ifdef _WIN32
+	SetConsoleOutputCP(CP_UTF8);
+#endif
+
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 2;
+
+	const std::unique_ptr<ice::DiagnosticSink> sink = CreateDiagnosticSink(options.Diagnostics);
+	const bool isSucceeded = options.Build ? BuildModules(options, *sink)
+							 : options.Jobs != 0 ? LexConcurrently(options, *sink) : LexSequentially(options, *sink);
+
+	return isSucceeded ? 0 : 1;
 }
\ No newline at end of file
@@ -1,40 +1,262 @@
 #include <ice/Memory.hpp>
 
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <Windows.h>
+#else
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace {
+	std::size_t GetPageSize() noexcept {
+#ifdef _WIN32
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+#else
+		return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+	}
+
+	const std::size_t s_PageSize = GetPageSize();
+}
+
 namespace ice {
-	Stack::Stack()
-		: Stack(1 * 1024 * 1024) {
+	Stack::Stack() noexcept
+		: Stack(DefaultReserveSize) {
 	}
-	Stack::Stack(std::size_t size)
-		: m_Data(new std::uint8_t[size]), m_Size(size) {
+	Stack::Stack(std::size_t reserveSize) noexcept {
+		const std::size_t granularity = std::max(CommitSize, s_PageSize);
+		if (reserveSize == 0 || reserveSize > std::numeric_limits<std::size_t>::max() - granularity - s_PageSize) return;
+
+		reserveSize = (reserveSize + granularity - 1) / granularity * granularity;
+
+#ifdef _WIN32
+		void* const data = VirtualAlloc(nullptr, reserveSize + s_PageSize, MEM_RESERVE, PAGE_NOACCESS);
+		if (data == nullptr) return;
+#else
+		void* const data = mmap(nullptr, reserveSize + s_PageSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (data == MAP_FAILED) return;
+#endif
+
+		m_Base = m_Top = m_Committed = static_cast<std::uint8_t*>(data);
+		m_Limit = m_Base + reserveSize;
+		m_ReservedSize = reserveSize + s_PageSize;
 	}
 	Stack::Stack(Stack&& stack) noexcept
-		: m_Data(stack.m_Data), m_Size(stack.m_Size) {
-		stack.m_Data = nullptr;
-		stack.m_Size = 0;
+		: m_Base(stack.m_Base), m_Top(stack.m_Top), m_Committed(stack.m_Committed), m_Limit(stack.m_Limit), m_ReservedSize(stack.m_ReservedSize) {
+		stack.m_Base = stack.m_Top = stack.m_Committed = stack.m_Limit = nullptr;
+		stack.m_ReservedSize = 0;
 	}
 	Stack::~Stack() {
-		delete m_Data;
+		Release();
 	}
 
 	Stack& Stack::operator=(Stack&& stack) noexcept {
-		delete m_Data;
+		Release();
 
-		m_Data = stack.m_Data;
-		m_Size = stack.m_Size;
-	
-		stack.m_Data = nullptr;
-		stack.m_Size = 0;
+		m_Base = stack.m_Base;
+		m_Top = stack.m_Top;
+		m_Committed = stack.m_Committed;
+		m_Limit = stack.m_Limit;
+		m_ReservedSize = stack.m_ReservedSize;
+
+		stack.m_Base = stack.m_Top = stack.m_Committed = stack.m_Limit = nullptr;
+		stack.m_ReservedSize = 0;
 
 		return *this;
 	}
-	const std::uint8_t& Stack::operator[](std::size_t index) const noexcept {
-		return m_Data[index];
+
+	bool Stack::IsReserved() const noexcept {
+		return m_Base != nullptr;
 	}
-	std::uint8_t& Stack::operator[](std::size_t index) noexcept {
-		return m_Data[index];
+	bool Stack::IsEmpty() const noexcept {
+		return m_Top == m_Base;
 	}
-
 	std::size_t Stack::Size() const noexcept {
+		return static_cast<std::size_t>(m_Top - m_Base);
+	}
+	std::size_t Stack::Capacity() const noexcept {
+		return static_cast<std::size_t>(m_Limit - m_Base);
+	}
+	std::size_t Stack::CommittedSize() const noexcept {
+		return static_cast<std::size_t>(m_Committed - m_Base);
+	}
+	std::uint8_t* Stack::Base() const noexcept {
+		return m_Base;
+	}
+	std::uint8_t* Stack::Top() const noexcept {
+		return m_Top;
+	}
+	void Stack::Clear() noexcept {
+		m_Top = m_Base;
+	}
+	void Stack::Trim() noexcept {
+		const std::size_t granularity = std::max(CommitSize, s_PageSize);
+		std::uint8_t* const newCommitted = m_Base + (Size() + granularity - 1) / granularity * granularity;
+		if (newCommitted >= m_Committed) return;
+
+		const std::size_t size = static_cast<std::size_t>(m_Committed - newCommitted);
+#ifdef _WIN32
+		if (!VirtualFree(newCommitted, size, MEM_DECOMMIT)) return;
+#else
+		if (mmap(newCommitted, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0) == MAP_FAILED) return;
+#endif
+		m_Committed = newCommitted;
+	}
+
+	bool Stack::Commit(std::size_t size) noexcept {
+		if (size > static_cast<std::size_t>(m_Limit - m_Top)) return false;
+
+		const std::size_t granularity = std::max(CommitSize, s_PageSize);
+		const std::size_t required = static_cast<std::size_t>(m_Top + size - m_Committed);
+		const std::size_t commitSize = std::min((required + granularity - 1) / granularity * granularity, static_cast<std::size_t>(m_Limit - m_Committed));
+
+#ifdef _WIN32
+		if (VirtualAlloc(m_Committed, commitSize, MEM_COMMIT, PAGE_READWRITE) == nullptr) return false;
+#else
+		if (mprotect(m_Committed, commitSize, PROT_READ | PROT_WRITE) != 0) return false;
+#endif
+
+		m_Committed += commitSize;
+		return true;
+	}
+	void Stack::Release() noexcept {
+		if (m_Base == nullptr) return;
+
+#ifdef _WIN32
+		VirtualFree(m_Base, 0, MEM_RELEASE);
+#else
+		munmap(m_Base, m_ReservedSize);
+#endif
+		m_Base = m_Top = m_Committed = m_Limit = nullptr;
+		m_ReservedSize = 0;
+	}
+}
+
+namespace ice {
+	Arena::Arena(std::size_t slabSize) noexcept
+		: m_SlabSize(slabSize) {
+	}
+	Arena::Arena(Arena&& arena) noexcept
+		: m_Slabs(arena.m_Slabs), m_Current(arena.m_Current), m_End(arena.m_End), m_Finalizers(arena.m_Finalizers), m_SlabSize(arena.m_SlabSize),
+		  m_Size(arena.m_Size), m_Capacity(arena.m_Capacity) {
+		arena.m_Slabs = nullptr;
+		arena.m_Current = arena.m_End = nullptr;
+		arena.m_Finalizers = nullptr;
+		arena.m_Size = arena.m_Capacity = 0;
+	}
+	Arena::~Arena() {
+		Clear();
+	}
+
+	Arena& Arena::operator=(Arena&& arena) noexcept {
+		Clear();
+
+		m_Slabs = arena.m_Slabs;
+		m_Current = arena.m_Current;
+		m_End = arena.m_End;
+		m_Finalizers = arena.m_Finalizers;
+		m_SlabSize = arena.m_SlabSize;
+		m_Size = arena.m_Size;
+		m_Capacity = arena.m_Capacity;
+
+		arena.m_Slabs = nullptr;
+		arena.m_Current = arena.m_End = nullptr;
+		arena.m_Finalizers = nullptr;
+		arena.m_Size = arena.m_Capacity = 0;
+
+		return *this;
+	}
+
+	void Arena::Clear() noexcept {
+		RunFinalizers();
+
+		while (m_Slabs) {
+			Slab* const next = m_Slabs->Next;
+			::operator delete(m_Slabs);
+			m_Slabs = next;
+		}
+
+		m_Current = m_End = nullptr;
+		m_Size = m_Capacity = 0;
+	}
+	void Arena::Reset() noexcept {
+		RunFinalizers();
+		if (!m_Slabs) return;
+
+		while (m_Slabs->Next) {
+			Slab* const next = m_Slabs->Next->Next;
+			::operator delete(m_Slabs->Next);
+			m_Slabs->Next = next;
+		}
+
+		m_Current = GetSlabData(m_Slabs);
+		m_End = m_Current + m_Slabs->Size;
+		m_Size = 0;
+		m_Capacity = m_Slabs->Size;
+	}
+	std::size_t Arena::Size() const noexcept {
 		return m_Size;
 	}
+	std::size_t Arena::Capacity() const noexcept {
+		return m_Capacity;
+	}
+
+	std::string_view Arena::MakeString(std::string_view string) {
+		if (string.empty()) return std::string_view();
+
+		char* const data = static_cast<char*>(Allocate(string.size(), 1));
+		std::memcpy(data, string.data(), string.size());
+		return std::string_view(data, string.size());
+	}
+
+	void* Arena::AllocateSlow(std::size_t size, std::size_t alignment) {
+		const std::size_t required = size + alignment - 1;
+		if (required > m_SlabSize / 4) {
+			const std::uintptr_t data = reinterpret_cast<std::uintptr_t>(GetSlabData(AddSlab(required, false)));
+			m_Size += size;
+			return reinterpret_cast<void*>((data + alignment - 1) & ~(alignment - 1));
+		}
+
+		AddSlab(m_SlabSize, true);
+		return Allocate(size, alignment);
+	}
+	Arena::Slab* Arena::AddSlab(std::size_t size, bool isCurrent) {
+		Slab* const slab = static_cast<Slab*>(::operator new(sizeof(Slab) + size));
+		slab->Size = size;
+		m_Capacity += size;
+
+		if (isCurrent || !m_Slabs) {
+			slab->Next = m_Slabs;
+			m_Slabs = slab;
+		} else {
+			slab->Next = m_Slabs->Next;
+			m_Slabs->Next = slab;
+		}
+
+		if (isCurrent) {
+			m_Current = GetSlabData(slab);
+			m_End = m_Current + size;
+		}
+		return slab;
+	}
+	std::uint8_t* Arena::GetSlabData(Slab* slab) noexcept {
+		return reinterpret_cast<std::uint8_t*>(slab + 1);
+	}
+	void Arena::AddFinalizer(void* object, void(*destroy)(void* object) noexcept) {
+		m_Finalizers = new(Allocate(sizeof(Finalizer), alignof(Finalizer))) Finalizer{ m_Finalizers, object, destroy };
+	}
+	void Arena::RunFinalizers() noexcept {
+		for (Finalizer* finalizer = m_Finalizers; finalizer; finalizer = finalizer->Next) {
+			finalizer->Destroy(finalizer->Object);
+		}
+		m_Finalizers = nullptr;
+	}
 }
\ No newline at end of file
@@ -1,42 +1,114 @@
 #include <ice/Message.hpp>
 
+#include <ice/DiagnosticEngine.hpp>
 #include <ice/Encoding.hpp>
+#include <ice/Utility.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <iostream>
-#include <sstream>
+#include <iterator>
 #include <utility>
 
+namespace {
+	constexpr std::string_view s_DiagnosticNames[] = {
+#define E(x, y) #x
+#include <ice/detail/Diagnostic.txt>
+#undef E
+	};
+
+	constexpr bool CheckDiagnosticFormats() noexcept {
+		for (std::string_view format : ice::detail::DiagnosticFormats) {
+			if (ice::GetFormatArgumentCount(format) > ice::Message::MaxArguments) return false;
+		}
+		return true;
+	}
+	static_assert(CheckDiagnosticFormats(), "diagnostic format has more placeholders than a message can hold");
+}
+
 namespace ice {
-	Message::Message(MessageType type, std::string description)
-		: m_Type(type), m_Description(std::move(description)) {
+	std::string_view GetDiagnosticName(DiagnosticId id) noexcept {
+		return s_DiagnosticNames[static_cast<std::size_t>(id)];
 	}
-	Message::Message(MessageType type, std::string description, std::string location)
-		: m_Type(type), m_Description(std::move(description)), m_Location(std::move(location)) {
+}
+
+namespace ice {
+	MessageArgument::MessageArgument() noexcept
+		: m_Integer(0) {
 	}
-	Message::Message(MessageType type, std::string description, std::string location, std::string note)
-		: m_Type(type), m_Description(std::move(description)), m_Location(std::move(location)), m_Note(std::move(note)) {
+	MessageArgument::MessageArgument(char character) noexcept
+		: m_Type(MessageArgumentType::Character), m_Character(character) {
 	}
-	Message::Message(const Message& message)
-		: m_Type(message.m_Type), m_Description(message.m_Description), m_Location(message.m_Location), m_Note(message.m_Note) {
+	MessageArgument::MessageArgument(std::int64_t integer) noexcept
+		: m_Type(MessageArgumentType::Integer), m_Integer(integer) {
 	}
-	Message::Message(Message&& message) noexcept
-		: m_Type(message.m_Type), m_Description(std::move(message.m_Description)), m_Location(std::move(message.m_Location)), m_Note(std::move(message.m_Note)) {
-		message.m_Type = MessageType::None;
+	MessageArgument::MessageArgument(const char* string) noexcept
+		: MessageArgument(std::string_view(string)) {
+	}
+	MessageArgument::MessageArgument(std::string_view string) noexcept
+		: m_Type(MessageArgumentType::String), m_Length(static_cast<std::uint32_t>(string.size())), m_String(string.data()) {
 	}
 
-	Message& Message::operator=(const Message& message) {
-		m_Type = message.m_Type;
-		m_Description = message.m_Description;
-		m_Location = message.m_Location;
-		m_Note = message.m_Note;
+	MessageArgument MessageArgument::Span(std::size_t begin, std::size_t length) noexcept {
+		MessageArgument result;
+		result.m_Type = MessageArgumentType::Span;
+		result.m_Length = static_cast<std::uint32_t>(length);
+		result.m_Begin = static_cast<std::uint32_t>(begin);
+		return result;
+	}
+	MessageArgument MessageArgument::OwnedString(std::size_t begin, std::size_t length) noexcept {
+		MessageArgument result;
+		result.m_Type = MessageArgumentType::OwnedString;
+		result.m_Length = static_cast<std::uint32_t>(length);
+		result.m_Begin = static_cast<std::uint32_t>(begin);
+		return result;
+	}
 
-		return *this;
+	MessageArgumentType MessageArgument::Type() const noexcept {
+		return m_Type;
+	}
+	char MessageArgument::Character() const noexcept {
+		return m_Character;
+	}
+	std::int64_t MessageArgument::Integer() const noexcept {
+		return m_Integer;
+	}
+	std::string_view MessageArgument::String() const noexcept {
+		return std::string_view(m_String, m_Length);
 	}
-	Message& Message::operator=(Message&& message) noexcept {
-		m_Type = std::move(message.m_Type);
-		m_Description = std::move(message.m_Description);
-		m_Location = std::move(message.m_Location);
-		m_Note = std::move(message.m_Note);
+	std::size_t MessageArgument::Begin() const noexcept {
+		return m_Begin;
+	}
+	std::size_t MessageArgument::Length() const noexcept {
+		return m_Length;
+	}
+}
+
+namespace ice {
+	Message::Message(MessageType type, DiagnosticId id, std::uint32_t source) noexcept
+		: m_Type(type), m_Id(id), m_Source(source) {
+	}
+	Message::Message(MessageType type, DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length,
+					 std::initializer_list<MessageArgument> arguments) noexcept
+		: m_Type(type), m_Id(id), m_Source(source), m_Line(static_cast<std::uint32_t>(line)), m_Column(static_cast<std::uint32_t>(column)),
+		  m_Length(static_cast<std::uint32_t>(length)) {
+		std::copy_n(arguments.begin(), std::min(arguments.size(), MaxArguments), m_Arguments.begin());
+	}
+	Message::Message(const Message& message) noexcept
+		: m_Type(message.m_Type), m_Id(message.m_Id), m_Source(message.m_Source), m_Line(message.m_Line), m_Column(message.m_Column),
+		  m_Length(message.m_Length), m_Snippet(message.m_Snippet), m_SnippetLength(message.m_SnippetLength), m_Arguments(message.m_Arguments) {
+	}
+
+	Message& Message::operator=(const Message& message) noexcept {
+		m_Type = message.m_Type;
+		m_Id = message.m_Id;
+		m_Source = message.m_Source;
+		m_Line = message.m_Line;
+		m_Column = message.m_Column;
+		m_Length = message.m_Length;
+		m_Snippet = message.m_Snippet;
+		m_SnippetLength = message.m_SnippetLength;
+		m_Arguments = message.m_Arguments;
 
 		return *this;
 	}
@@ -44,182 +116,457 @@ namespace ice {
 	MessageType Message::Type() const noexcept {
 		return m_Type;
 	}
-	std::string Message::Description() const {
-		return m_Description;
+	DiagnosticId Message::Id() const noexcept {
+		return m_Id;
+	}
+	std::uint32_t Message::Source() const noexcept {
+		return m_Source;
+	}
+	void Message::Source(std::uint32_t newSource) noexcept {
+		m_Source = newSource;
+	}
+	std::size_t Message::Line() const noexcept {
+		return m_Line;
+	}
+	void Message::Line(std::size_t newLine) noexcept {
+		m_Line = static_cast<std::uint32_t>(newLine);
+	}
+	std::size_t Message::Column() const noexcept {
+		return m_Column;
+	}
+	std::size_t Message::Length() const noexcept {
+		return m_Length;
+	}
+	bool Message::HasSnippet() const noexcept {
+		return m_Snippet != NoSnippet;
+	}
+	std::uint32_t Message::Snippet() const noexcept {
+		return m_Snippet;
 	}
-	std::string Message::Location() const {
-		return m_Location;
+	std::size_t Message::SnippetLength() const noexcept {
+		return m_SnippetLength;
 	}
-	std::string Message::Note() const {
-		return m_Note;
+	void Message::Snippet(std::uint32_t newSnippet, std::size_t newSnippetLength) noexcept {
+		m_Snippet = newSnippet;
+		m_SnippetLength = static_cast<std::uint32_t>(newSnippetLength);
 	}
+	const MessageArgument& Message::Argument(std::size_t index) const noexcept {
+		return m_Arguments[index];
+	}
+	void Message::Argument(std::size_t index, const MessageArgument& newArgument) noexcept {
+		m_Arguments[index] = newArgument;
+	}
+}
 
-	std::string Message::ToString() const {
-		std::ostringstream oss;
-		
-		if (!m_Location.empty()) {
-			oss << m_Location << ": ";
-		}
+namespace {
+	std::size_t GetRenderedWidth(std::string_view source) noexcept {
+		return ice::DisplayWidth(source) + std::count(source.begin(), source.end(), '\t') * 3;
+	}
 
-		switch (m_Type) {
-		case MessageType::Note:
-			oss << "note: ";
+	void AppendInteger(std::string& result, std::uint64_t integer) {
+		char buffer[20];
+		const auto [end, error] = std::to_chars(std::begin(buffer), std::end(buffer), integer);
+		result.append(buffer, end);
+	}
+	struct MessageFormatContext final {
+		const ice::Message* Message;
+		std::string_view Snippet;
+		std::string_view Strings;
+	};
+
+	void AppendMessageArgument(std::string& result, const ice::MessageArgument& argument, std::string_view snippet, std::string_view strings) {
+		switch (argument.Type()) {
+		case ice::MessageArgumentType::Character:
+			ice::AppendFormatArgument(result, argument.Character());
 			break;
 
-		case MessageType::Warning:
-			oss << "warning: ";
+		case ice::MessageArgumentType::Integer:
+			ice::AppendFormatArgument(result, argument.Integer());
 			break;
 
-		case MessageType::Error:
-			oss << "error: ";
+		case ice::MessageArgumentType::Span:
+			ice::AppendFormatArgument(result, snippet.substr(std::min(argument.Begin(), snippet.size()), argument.Length()));
 			break;
-		}
 
-		oss << m_Description;
+		case ice::MessageArgumentType::OwnedString:
+			ice::AppendFormatArgument(result, strings.substr(std::min(argument.Begin(), strings.size()), argument.Length()));
+			break;
 
-		if (!m_Note.empty()) {
-			oss << '\n' << m_Note;
+		default:
+			break;
 		}
-
-		return oss.str();
 	}
-}
-
-namespace ice {
-	std::string CreateMessageLocation(std::size_t line, std::size_t column) {
-		std::ostringstream oss;
-		oss << line << ':' << column + 1;
-		return oss.str();
-	}
-	std::string CreateMessageLocation(const std::string& source) {
-		return source;
-	}
-	std::string CreateMessageLocation(const std::string& source, std::size_t line, std::size_t column) {
-		std::ostringstream oss;
-		oss << source << ':' << line << ':' << column + 1;
-		return oss.str();
-	}
-	std::string CreateMessageNoteLocation(const std::string& source, std::size_t line, std::size_t column, std::size_t length) {
-		const std::string lineString = std::to_string(line);
-		const std::string emptyLineBar = std::string(lineString.size() + 1, ' ') + '|';
-		const std::string lineBar = lineString + " | ";
-		
-		std::string result = emptyLineBar + '\n' + lineBar;
-		std::size_t realColumn = column, realLength = length;
-		
-		for (std::size_t i = 0; i < source.size();) {
-			const char c = source[i];
-			const int cLength = GetCodepointLength(source[i]);
+	void AppendSnippet(std::string& result, std::string_view source, std::size_t line, std::size_t column, std::size_t length) {
+		char lineBuffer[20];
+		const std::string_view lineString(lineBuffer, std::to_chars(std::begin(lineBuffer), std::end(lineBuffer), line).ptr - lineBuffer);
 
+		result.append(lineString.size() + 1, ' ').append("|\n");
+		result.append(lineString).append(" | ");
+		for (char c : source) {
 			if (c == '\t') {
-				result += "    ";
-				if (i < column) {
-					realColumn += 3;
-				} else {
-					realLength += 3;
-				}
+				result.append("    ");
 			} else {
-				result.insert(result.end(), source.begin() + i, source.begin() + i + cLength);
-				if (IsFullWidth(GetCodepoint(source.c_str() + i, cLength))) {
-					if (i < column) {
-						++realColumn;
-					} else {
-						++realLength;
-					}
-				}
+				result.push_back(c);
 			}
-
-			i += cLength;
 		}
 
-		result += '\n' + emptyLineBar + std::string(realColumn + 1, ' ') + std::string(realLength, '^');
-		return result;
+		const std::size_t columnEnd = std::min(column, source.size());
+		const std::size_t lengthEnd = std::min(std::max(column + length, columnEnd), source.size());
+		const std::size_t realColumn = GetRenderedWidth(source.substr(0, columnEnd)) + (column - columnEnd);
+		const std::size_t realLength = GetRenderedWidth(source.substr(columnEnd, lengthEnd - columnEnd)) + (column + length - std::max(lengthEnd, column));
+
+		result.push_back('\n');
+		result.append(lineString.size() + 1, ' ').append("|").append(realColumn + 1, ' ').append(realLength, '^');
 	}
 }
 
 namespace ice {
+	Messages::Messages(DiagnosticSink& sink) noexcept
+		: m_Sink(&sink) {
+	}
+	Messages::Messages(DiagnosticEngine& engine) noexcept
+		: m_Engine(&engine) {
+	}
 	Messages::Messages(const Messages& messages)
-		: m_Messages(messages.m_Messages) {
+		: m_Messages(messages.m_Messages), m_Sources(messages.m_Sources), m_Snippets(messages.m_Snippets), m_LastSnippet(messages.m_LastSnippet),
+		  m_Strings(messages.m_Strings), m_ErrorCount(messages.m_ErrorCount), m_WarningCount(messages.m_WarningCount), m_Sink(messages.m_Sink), m_Engine(messages.m_Engine) {
 	}
 	Messages::Messages(Messages&& messages) noexcept
-		: m_Messages(std::move(messages.m_Messages)) {
+		: m_Messages(std::move(messages.m_Messages)), m_Sources(std::move(messages.m_Sources)), m_Snippets(std::move(messages.m_Snippets)),
+		  m_LastSnippet(messages.m_LastSnippet), m_Strings(std::move(messages.m_Strings)), m_ErrorCount(messages.m_ErrorCount),
+		  m_WarningCount(messages.m_WarningCount), m_Sink(messages.m_Sink), m_Engine(messages.m_Engine) {
+		messages.m_LastSnippet = NoSnippet;
+		messages.m_ErrorCount = 0;
+		messages.m_WarningCount = 0;
 	}
 
 	Messages& Messages::operator=(const Messages& messages) {
 		m_Messages = messages.m_Messages;
+		m_Sources = messages.m_Sources;
+		m_Snippets = messages.m_Snippets;
+		m_LastSnippet = messages.m_LastSnippet;
+		m_Strings = messages.m_Strings;
+		m_ErrorCount = messages.m_ErrorCount;
+		m_WarningCount = messages.m_WarningCount;
+		m_Sink = messages.m_Sink;
+		m_Engine = messages.m_Engine;
 
 		return *this;
 	}
 	Messages& Messages::operator=(Messages&& messages) noexcept {
 		m_Messages = std::move(messages.m_Messages);
+		m_Sources = std::move(messages.m_Sources);
+		m_Snippets = std::move(messages.m_Snippets);
+		m_LastSnippet = messages.m_LastSnippet;
+		m_Strings = std::move(messages.m_Strings);
+		m_ErrorCount = messages.m_ErrorCount;
+		m_WarningCount = messages.m_WarningCount;
+		m_Sink = messages.m_Sink;
+		m_Engine = messages.m_Engine;
 
+		messages.m_LastSnippet = NoSnippet;
+		messages.m_ErrorCount = 0;
+		messages.m_WarningCount = 0;
 		return *this;
 	}
+	const Message& Messages::operator[](std::size_t index) const noexcept {
+		return m_Messages[index];
+	}
 
 	void Messages::Clear() noexcept {
 		m_Messages.clear();
+		m_Sources.clear();
+		m_Snippets.clear();
+		m_LastSnippet = NoSnippet;
+		m_Strings.clear();
+		m_ErrorCount = 0;
+		m_WarningCount = 0;
 	}
 	bool Messages::IsEmpty() const noexcept {
 		return m_Messages.empty();
 	}
+	std::size_t Messages::Size() const noexcept {
+		return m_Messages.size();
+	}
 	bool Messages::HasErrors() const noexcept {
-		for (const Message& message : m_Messages) {
-			if (message.Type() == MessageType::Error) return true;
-		}
-		return false;
+		return m_ErrorCount != 0;
+	}
+	std::size_t Messages::ErrorCount() const noexcept {
+		return m_ErrorCount;
+	}
+	std::size_t Messages::WarningCount() const noexcept {
+		return m_WarningCount;
 	}
 	void Messages::Print() const {
-		bool isFirst = true;
+		TerminalDiagnosticSink sink(std::cout);
+		Print(sink);
+	}
+	void Messages::Print(DiagnosticSink& sink) const {
 		for (const Message& message : m_Messages) {
-			if (isFirst) {
-				isFirst = false;
-			} else {
-				std::cout << '\n';
-			}
-			std::cout << message.ToString() << "\n";
+			sink.Write(*this, message);
 		}
+		sink.Flush();
 	}
-
-	void Messages::Add(Message message) {
-		m_Messages.push_back(std::move(message));
+	DiagnosticSink* Messages::Sink() const noexcept {
+		return m_Sink;
 	}
-	void Messages::AddNote(const std::string& description, const std::string& source) {
-		if (source.empty()) {
-			Add(Message(MessageType::Note, description, CreateMessageLocation(source)));
-		} else {
-			Add(Message(MessageType::Note, description));
+	void Messages::Sink(DiagnosticSink* newSink) noexcept {
+		m_Sink = newSink;
+	}
+	DiagnosticEngine* Messages::Engine() const noexcept {
+		return m_Engine;
+	}
+	void Messages::Engine(DiagnosticEngine* newEngine) noexcept {
+		m_Engine = newEngine;
+	}
+
+	std::uint32_t Messages::AddSource(std::string_view name) {
+		for (std::size_t i = m_Sources.size(); i > 0; --i) {
+			if (m_Sources[i - 1] == name) return static_cast<std::uint32_t>(i - 1);
 		}
+
+		m_Sources.emplace_back(name);
+		return static_cast<std::uint32_t>(m_Sources.size() - 1);
+	}
+	std::string_view Messages::SourceName(std::uint32_t source) const noexcept {
+		if (source < m_Sources.size()) return m_Sources[source];
+		else return {};
+	}
+	std::string_view Messages::Snippet(const Message& message) const noexcept {
+		if (message.HasSnippet()) return std::string_view(m_Snippets).substr(message.Snippet(), message.SnippetLength());
+		else return {};
 	}
-	void Messages::AddNote(const std::string& description, const std::string& source, std::size_t line, std::size_t column) {
-		AddNote(description, source, line, column, "");
+
+	std::string Messages::Description(const Message& message) const {
+		std::string result;
+		AppendDescription(result, message);
+		return result;
 	}
-	void Messages::AddNote(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note) {
-		if (source.empty()) {
-			Add(Message(MessageType::Note, description, CreateMessageLocation(line, column), note));
+	std::string Messages::Location(const Message& message) const {
+		std::string result;
+		AppendLocation(result, message);
+		return result;
+	}
+	std::string Messages::Note(const Message& message) const {
+		std::string result;
+		AppendNote(result, message);
+		return result;
+	}
+	std::string Messages::ToString(const Message& message) const {
+		std::string result;
+		Append(result, message);
+		return result;
+	}
+
+	void Messages::Add(Message message) {
+		for (std::size_t i = 0; i < Message::MaxArguments; ++i) {
+			if (message.Argument(i).Type() != MessageArgumentType::String) continue;
+
+			const std::string_view string = message.Argument(i).String();
+			message.Argument(i, MessageArgument::OwnedString(m_Strings.size(), string.size()));
+			m_Strings.append(string);
+		}
+
+		if (message.Type() == MessageType::Error) {
+			++m_ErrorCount;
+		} else if (message.Type() == MessageType::Warning) {
+			++m_WarningCount;
+		}
+		if (m_Engine) {
+			m_Engine->Count(message.Type());
+		}
+
+		if (m_Sink) {
+			m_Sink->Write(*this, message);
+			if (message.HasSnippet()) {
+				m_Snippets.clear();
+				m_LastSnippet = NoSnippet;
+			}
+			m_Strings.clear();
 		} else {
-			Add(Message(MessageType::Note, description, CreateMessageLocation(source, line, column), note));
+			m_Messages.push_back(message);
 		}
 	}
-	void Messages::AddWarning(const std::string& description, const std::string& source, std::size_t line, std::size_t column) {
-		AddWarning(description, source, line, column, "");
+	void Messages::Add(Message message, std::string_view snippet) {
+		if (m_LastSnippet == NoSnippet || std::string_view(m_Snippets).substr(m_LastSnippet) != snippet) {
+			if (m_Snippets.size() + snippet.size() > NoSnippet) return Add(message);
+
+			m_LastSnippet = static_cast<std::uint32_t>(m_Snippets.size());
+			m_Snippets.append(snippet);
+		}
+
+		message.Snippet(m_LastSnippet, snippet.size());
+		Add(message);
+	}
+	void Messages::Merge(Messages messages) {
+		const std::size_t errorCount = messages.m_ErrorCount;
+		const std::size_t warningCount = messages.m_WarningCount;
+		if (m_Engine) {
+			m_Engine->Count(MessageType::Error, errorCount);
+			m_Engine->Count(MessageType::Warning, warningCount);
+		}
+
+		if (m_Sink) {
+			for (const Message& message : messages.m_Messages) {
+				m_Sink->Write(messages, message);
+			}
+		} else if (m_Messages.empty() && m_Sources.empty()) {
+			m_Messages = std::move(messages.m_Messages);
+			m_Sources = std::move(messages.m_Sources);
+			m_Snippets = std::move(messages.m_Snippets);
+			m_LastSnippet = messages.m_LastSnippet;
+			m_Strings = std::move(messages.m_Strings);
+		} else {
+			std::vector<std::uint32_t> sources(messages.m_Sources.size());
+			for (std::size_t i = 0; i < sources.size(); ++i) {
+				sources[i] = AddSource(messages.m_Sources[i]);
+			}
+
+			const std::size_t snippetOffset = m_Snippets.size();
+			m_Snippets.append(messages.m_Snippets);
+			if (messages.m_LastSnippet != NoSnippet) {
+				m_LastSnippet = static_cast<std::uint32_t>(snippetOffset + messages.m_LastSnippet);
+			}
+
+			const std::size_t stringOffset = m_Strings.size();
+			m_Strings.append(messages.m_Strings);
+
+			m_Messages.reserve(m_Messages.size() + messages.m_Messages.size());
+			for (Message message : messages.m_Messages) {
+				if (message.Source() != NoSource) {
+					message.Source(sources[message.Source()]);
+				}
+				if (message.HasSnippet()) {
+					message.Snippet(static_cast<std::uint32_t>(snippetOffset + message.Snippet()), message.SnippetLength());
+				}
+				for (std::size_t i = 0; i < Message::MaxArguments; ++i) {
+					const MessageArgument& argument = message.Argument(i);
+					if (argument.Type() != MessageArgumentType::OwnedString) continue;
+
+					message.Argument(i, MessageArgument::OwnedString(stringOffset + argument.Begin(), argument.Length()));
+				}
+				m_Messages.push_back(message);
+			}
+		}
+
+		m_ErrorCount += errorCount;
+		m_WarningCount += warningCount;
+	}
+	void Messages::Sort() {
+		std::vector<std::size_t> primaries(m_Messages.size());
+		std::vector<std::size_t> order(m_Messages.size());
+		for (std::size_t i = 0; i < m_Messages.size(); ++i) {
+			const Message& message = m_Messages[i];
+			primaries[i] = i > 0 && message.Type() == MessageType::Note && message.Line() == 0 && message.Source() == NoSource ? primaries[i - 1] : i;
+			order[i] = i;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+			const Message& lhsMessage = m_Messages[primaries[lhs]];
+			const Message& rhsMessage = m_Messages[primaries[rhs]];
+			if (lhsMessage.Source() != rhsMessage.Source()) return lhsMessage.Source() < rhsMessage.Source();
+			else if (lhsMessage.Line() != rhsMessage.Line()) return lhsMessage.Line() < rhsMessage.Line();
+			else if (lhsMessage.Column() != rhsMessage.Column()) return lhsMessage.Column() < rhsMessage.Column();
+			else return primaries[lhs] < primaries[rhs];
+		});
+
+		std::vector<Message> messages;
+		messages.reserve(m_Messages.size());
+		for (std::size_t index : order) {
+			messages.push_back(m_Messages[index]);
+		}
+		m_Messages = std::move(messages);
 	}
-	void Messages::AddWarning(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note) {
-		if (source.empty()) {
-			Add(Message(MessageType::Warning, description, CreateMessageLocation(line, column), note));
+	void Messages::ShiftLines(std::size_t lineDelta) noexcept {
+		for (Message& message : m_Messages) {
+			if (message.Line() != 0) {
+				message.Line(message.Line() + lineDelta);
+			}
 		}
-		else {
-			Add(Message(MessageType::Warning, description, CreateMessageLocation(source, line, column), note));
+	}
+	void Messages::AddNote(DiagnosticId id, std::uint32_t source) {
+		Add(Message(MessageType::Note, id, source));
+	}
+	void Messages::AddNote(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Note, id, source, line, column, 0, arguments));
+	}
+	void Messages::AddNote(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+						   std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Note, id, source, line, column, length, arguments), snippet);
+	}
+	void Messages::AddWarning(DiagnosticId id, std::uint32_t source) {
+		Add(Message(MessageType::Warning, id, source));
+	}
+	void Messages::AddWarning(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Warning, id, source, line, column, 0, arguments));
+	}
+	void Messages::AddWarning(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+							  std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Warning, id, source, line, column, length, arguments), snippet);
+	}
+	void Messages::AddError(DiagnosticId id, std::uint32_t source) {
+		Add(Message(MessageType::Error, id, source));
+	}
+	void Messages::AddError(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Error, id, source, line, column, 0, arguments));
+	}
+	void Messages::AddError(DiagnosticId id, std::uint32_t source, std::size_t line, std::size_t column, std::size_t length, std::string_view snippet,
+							std::initializer_list<MessageArgument> arguments) {
+		Add(Message(MessageType::Error, id, source, line, column, length, arguments), snippet);
+	}
+
+	void Messages::AppendDescription(std::string& result, const Message& message) const {
+		const MessageFormatContext context = { &message, Snippet(message), m_Strings };
+		VFormatTo(result, GetDiagnosticFormat(message.Id()), Message::MaxArguments, [](std::string& result, std::size_t index, const void* context) {
+			const MessageFormatContext& formatContext = *static_cast<const MessageFormatContext*>(context);
+			AppendMessageArgument(result, formatContext.Message->Argument(index), formatContext.Snippet, formatContext.Strings);
+		}, &context);
+	}
+	void Messages::AppendLocation(std::string& result, const Message& message) const {
+		result.append(SourceName(message.Source()));
+		if (message.Line() == 0) return;
+
+		if (message.Source() != NoSource && !SourceName(message.Source()).empty()) {
+			result.push_back(':');
 		}
+		AppendInteger(result, static_cast<std::uint64_t>(message.Line()));
+		result.push_back(':');
+		AppendInteger(result, static_cast<std::uint64_t>(message.Column() + 1));
 	}
-	void Messages::AddError(const std::string& description, const std::string& source, std::size_t line, std::size_t column) {
-		AddError(description, source, line, column, "");
+	void Messages::AppendNote(std::string& result, const Message& message) const {
+		if (message.HasSnippet()) {
+			AppendSnippet(result, Snippet(message), message.Line(), message.Column(), message.Length());
+		}
 	}
-	void Messages::AddError(const std::string& description, const std::string& source, std::size_t line, std::size_t column, const std::string& note) {
-		if (source.empty()) {
-			Add(Message(MessageType::Error, description, CreateMessageLocation(line, column), note));
+	void Messages::Append(std::string& result, const Message& message) const {
+		const std::size_t locationBegin = result.size();
+		AppendLocation(result, message);
+		if (result.size() != locationBegin) {
+			result.append(": ");
+		}
+
+		switch (message.Type()) {
+		case MessageType::Note:
+			result.append("note: ");
+			break;
+
+		case MessageType::Warning:
+			result.append("warning: ");
+			break;
+
+		case MessageType::Error:
+			result.append("error: ");
+			break;
+
+		default:
+			break;
 		}
-		else {
-			Add(Message(MessageType::Error, description, CreateMessageLocation(source, line, column), note));
+
+		AppendDescription(result, message);
+
+		if (message.HasSnippet()) {
+			result.push_back('\n');
+			AppendNote(result, message);
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,816 @@
+#include <ice/Parser.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+	using ice::TokenType;
+	using ice::ast::NodeIndex;
+	using ice::ast::NodeKind;
+	using ice::ast::NoNode;
+
+	constexpr const char* s_QuotedTokenTypeWords[] = {
+#define E(x, y) "'" y "'"
+#include <ice/detail/TokenType.txt>
+#undef E
+	};
+
+	constexpr std::size_t ToIndex(TokenType type) noexcept {
+		return static_cast<std::size_t>(type);
+	}
+
+	const char* GetTokenDescription(TokenType type) noexcept {
+		switch (type) {
+		case TokenType::None: return "end of file";
+		case TokenType::EOL: return "end of line";
+		case TokenType::Identifer: return "identifier";
+		case TokenType::BinInteger:
+		case TokenType::OctInteger:
+		case TokenType::DecInteger:
+		case TokenType::HexInteger: return "integer literal";
+		case TokenType::Decimal: return "decimal literal";
+		case TokenType::Character: return "character literal";
+		case TokenType::String: return "string literal";
+		default: return s_QuotedTokenTypeWords[ToIndex(type)];
+		}
+	}
+
+	enum class Precedence : int {
+		None,
+		Assignment,
+		Conditional,
+		LogicalOr,
+		LogicalAnd,
+		BitOr,
+		BitXor,
+		BitAnd,
+		Equality,
+		Relational,
+		Shift,
+		Additive,
+		Multiplicative,
+		Exponent,
+		Prefix,
+		Postfix,
+	};
+
+	constexpr int ToInt(Precedence precedence) noexcept {
+		return static_cast<int>(precedence);
+	}
+
+	Precedence GetInfixPrecedence(TokenType type) noexcept {
+		switch (type) {
+		case TokenType::Assign:
+		case TokenType::PlusAssign:
+		case TokenType::MinusAssign:
+		case TokenType::MultiplyAssign:
+		case TokenType::DivideAssign:
+		case TokenType::ModuloAssign:
+		case TokenType::ExponentAssign:
+		case TokenType::BitAndAssign:
+		case TokenType::BitOrAssign:
+		case TokenType::BitXorAssign:
+		case TokenType::BitLeftShiftAssign:
+		case TokenType::BitRightShiftAssign:
+		case TokenType::RightwardsDoubleArrow:
+			return Precedence::Assignment;
+
+		case TokenType::Question: return Precedence::Conditional;
+		case TokenType::Or: return Precedence::LogicalOr;
+		case TokenType::And: return Precedence::LogicalAnd;
+		case TokenType::BitOr: return Precedence::BitOr;
+		case TokenType::BitXor: return Precedence::BitXor;
+		case TokenType::BitAnd: return Precedence::BitAnd;
+
+		case TokenType::Equal:
+		case TokenType::NotEqual:
+			return Precedence::Equality;
+
+		case TokenType::Greater:
+		case TokenType::GreaterEqual:
+		case TokenType::Less:
+		case TokenType::LessEqual:
+		case TokenType::IsKeyword:
+		case TokenType::AsKeyword:
+			return Precedence::Relational;
+
+		case TokenType::BitLeftShift:
+		case TokenType::BitRightShift:
+			return Precedence::Shift;
+
+		case TokenType::Plus:
+		case TokenType::Minus:
+			return Precedence::Additive;
+
+		case TokenType::Multiply:
+		case TokenType::Divide:
+		case TokenType::Modulo:
+			return Precedence::Multiplicative;
+
+		case TokenType::Exponent: return Precedence::Exponent;
+
+		case TokenType::LeftParen:
+		case TokenType::LeftBigParen:
+		case TokenType::Dot:
+		case TokenType::Increment:
+		case TokenType::Decrement:
+			return Precedence::Postfix;
+
+		default: return Precedence::None;
+		}
+	}
+	bool IsAssignment(TokenType type) noexcept {
+		return GetInfixPrecedence(type) == Precedence::Assignment && type != TokenType::RightwardsDoubleArrow;
+	}
+	bool IsRightAssociative(TokenType type) noexcept {
+		return type == TokenType::Exponent || GetInfixPrecedence(type) == Precedence::Assignment;
+	}
+	bool IsBuiltinType(TokenType type) noexcept {
+		return type >= TokenType::Int8Keyword && type <= TokenType::ObjectKeyword &&
+			type != TokenType::TrueKeyword && type != TokenType::FalseKeyword && type != TokenType::NullKeyword;
+	}
+	bool IsStatementEnd(TokenType type) noexcept {
+		return type == TokenType::None || type == TokenType::EOL || type == TokenType::Semicolon || type == TokenType::RightBrace;
+	}
+}
+
+namespace ice {
+	Parser::Parser(Interner& interner) noexcept
+		: m_Interner(&interner) {
+	}
+
+	bool Parser::Parse(const std::string& sourceName, const TokenBuffer& tokens, ast::Tree& tree, Messages& messages) {
+		m_Tokens = &tokens;
+		m_Types = tokens.Types().data();
+		m_TokenCount = tokens.Size();
+		m_Lexer = nullptr;
+
+		return Begin(sourceName, tree, messages);
+	}
+	bool Parser::Parse(const std::string& sourceName, Lexer& lexer, ast::Tree& tree, Messages& messages) {
+		m_Tokens = nullptr;
+		m_Types = nullptr;
+		m_TokenCount = 0;
+		m_Lexer = &lexer;
+
+		return Begin(sourceName, tree, messages);
+	}
+	std::size_t Parser::TokenCount() const noexcept {
+		return m_Index;
+	}
+
+	bool Parser::Begin(const std::string& sourceName, ast::Tree& tree, Messages& messages) {
+		m_Tree = &tree;
+		m_SourceName = &sourceName;
+		m_Source = NoSource;
+		m_Messages = &messages;
+		m_ParenDepth = 0;
+		m_Depth = 0;
+		m_IsRecovering = false;
+		m_ErrorIndex = ast::NoTokenIndex;
+		m_HasError = false;
+		m_Scratch.clear();
+
+		if (m_Lexer == nullptr) {
+			m_Tree->Reserve(m_TokenCount, m_TokenCount / 2);
+		}
+
+		m_Index = static_cast<std::uint32_t>(-1);
+		Next();
+		m_Tree->Root(ParseSourceFile());
+
+		m_Tokens = nullptr;
+		m_Types = nullptr;
+		m_Lexer = nullptr;
+		return !m_HasError;
+	}
+	ast::NodeIndex Parser::ParseSourceFile() {
+		const std::size_t begin = m_Scratch.size();
+		for (;;) {
+			while (m_Type == TokenType::EOL || m_Type == TokenType::Semicolon) {
+				Next();
+			}
+
+			if (m_Type == TokenType::None) break;
+			else if (m_Type == TokenType::RightBrace) {
+				AddError<DiagnosticId::ExpectedExpression>(GetTokenDescription(m_Type));
+				Next();
+				m_IsRecovering = false;
+				continue;
+			}
+
+			const NodeIndex statement = ParseStatement();
+			m_Scratch.push_back(statement);
+		}
+		return AddList(NodeKind::SourceFile, 0, begin);
+	}
+
+	ast::NodeIndex Parser::ParseStatement() {
+		if (!Enter()) {
+			const NodeIndex error = AddErrorNode();
+			Synchronize();
+			return error;
+		}
+
+		NodeIndex result;
+		bool needsEnd = true;
+		switch (m_Type) {
+		case TokenType::ModuleKeyword:
+			result = ParseModuleOrImport(NodeKind::ModuleDecl);
+			break;
+
+		case TokenType::ImportKeyword:
+			result = ParseModuleOrImport(NodeKind::ImportDecl);
+			break;
+
+		case TokenType::VarKeyword:
+		case TokenType::LetKeyword:
+			result = ParseVariableDecl();
+			break;
+
+		case TokenType::FunctionKeyword:
+			result = ParseFunctionDecl();
+			needsEnd = false;
+			break;
+
+		case TokenType::IfKeyword:
+			result = ParseIf();
+			needsEnd = false;
+			break;
+
+		case TokenType::WhileKeyword:
+			result = ParseWhile();
+			needsEnd = false;
+			break;
+
+		case TokenType::DoKeyword:
+			result = ParseDoWhile();
+			break;
+
+		case TokenType::ForKeyword:
+			result = ParseFor();
+			needsEnd = false;
+			break;
+
+		case TokenType::ReturnKeyword:
+			result = ParseJump(NodeKind::Return, true);
+			break;
+
+		case TokenType::ThrowKeyword:
+			result = ParseJump(NodeKind::Throw, true);
+			break;
+
+		case TokenType::BreakKeyword:
+			result = ParseJump(NodeKind::Break, false);
+			break;
+
+		case TokenType::ContinueKeyword:
+			result = ParseJump(NodeKind::Continue, false);
+			break;
+
+		case TokenType::LeftBrace:
+			result = ParseBlock();
+			needsEnd = false;
+			break;
+
+		default:
+			result = ParseExpression();
+			break;
+		}
+
+		if (m_IsRecovering) {
+			Synchronize();
+		} else if (needsEnd) {
+			ExpectStatementEnd();
+		}
+
+		Leave();
+		return result;
+	}
+	ast::NodeIndex Parser::ParseBlock() {
+		const std::uint32_t token = m_Index;
+		if (!Expect(TokenType::LeftBrace)) return AddErrorNode();
+
+		const std::size_t parenDepth = m_ParenDepth;
+		const std::size_t begin = m_Scratch.size();
+		m_ParenDepth = 0;
+		for (;;) {
+			while (m_Type == TokenType::EOL || m_Type == TokenType::Semicolon) {
+				Next();
+			}
+			if (m_Type == TokenType::RightBrace || m_Type == TokenType::None) break;
+
+			const std::uint32_t index = m_Index;
+			const NodeIndex statement = ParseStatement();
+			m_Scratch.push_back(statement);
+			if (m_Index == index) break;
+		}
+		m_ParenDepth = parenDepth;
+
+		Expect(TokenType::RightBrace);
+		return AddList(NodeKind::Block, token, begin);
+	}
+	ast::NodeIndex Parser::ParseModuleOrImport(ast::NodeKind kind) {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		const NodeIndex name = ParseQualifiedName();
+		return m_Tree->Add(kind, token, name);
+	}
+	ast::NodeIndex Parser::ParseVariableDecl() {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		if (m_Type != TokenType::Identifer) {
+			AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+		const Atom name = CurrentAtom();
+		Next();
+
+		const NodeIndex type = Accept(TokenType::Colon) ? ParseType() : NoNode;
+		NodeIndex initialization = NoNode;
+		if (Accept(TokenType::Assign)) {
+			SkipEOLs();
+			initialization = ParseExpression();
+		}
+		return m_Tree->AddVariableDecl(token, name, type, initialization);
+	}
+	ast::NodeIndex Parser::ParseFunctionDecl() {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		if (m_Type != TokenType::Identifer) {
+			AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+		const Atom name = CurrentAtom();
+		Next();
+
+		const std::uint32_t parameterToken = m_Index;
+		const std::size_t parenDepth = m_ParenDepth;
+		if (m_Type != TokenType::LeftParen) {
+			Expect(TokenType::LeftParen);
+			return AddErrorNode();
+		}
+		m_ParenDepth = parenDepth + 1;
+		Next();
+
+		const std::size_t begin = m_Scratch.size();
+		while (m_Type != TokenType::RightParen) {
+			const NodeIndex parameter = ParseParameter();
+			m_Scratch.push_back(parameter);
+			if (!Accept(TokenType::Comma)) break;
+		}
+		m_ParenDepth = parenDepth;
+		Expect(TokenType::RightParen);
+
+		const NodeIndex parameters = AddList(NodeKind::ParameterList, parameterToken, begin);
+		const NodeIndex returnType = Accept(TokenType::RightwardsArrow) ? ParseType() : NoNode;
+		SkipEOLs();
+
+		const NodeIndex body = ParseBlock();
+		return m_Tree->AddRecord(NodeKind::FunctionDecl, token, name, { parameters, returnType, body });
+	}
+	ast::NodeIndex Parser::ParseParameter() {
+		if (m_Type != TokenType::Identifer) {
+			AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+
+		const std::uint32_t token = m_Index;
+		const Atom name = CurrentAtom();
+		Next();
+
+		const NodeIndex type = Accept(TokenType::Colon) ? ParseType() : NoNode;
+		const NodeIndex defaultValue = Accept(TokenType::Assign) ? ParseExpression() : NoNode;
+		return m_Tree->AddRecord(NodeKind::Parameter, token, name, { type, defaultValue });
+	}
+	ast::NodeIndex Parser::ParseIf() {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		const NodeIndex condition = ParseExpression();
+		SkipEOLs();
+		const NodeIndex then = ParseBlock();
+
+		NodeIndex otherwise = NoNode;
+		SkipEOLs();
+		if (Accept(TokenType::ElseKeyword)) {
+			SkipEOLs();
+			if (m_Type != TokenType::IfKeyword) {
+				otherwise = ParseBlock();
+			} else if (Enter()) {
+				otherwise = ParseIf();
+				Leave();
+			} else {
+				otherwise = AddErrorNode();
+			}
+		}
+		return m_Tree->AddRecord(NodeKind::If, token, 0, { condition, then, otherwise });
+	}
+	ast::NodeIndex Parser::ParseWhile() {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		const NodeIndex condition = ParseExpression();
+		SkipEOLs();
+		const NodeIndex body = ParseBlock();
+		return m_Tree->Add(NodeKind::While, token, condition, body);
+	}
+	ast::NodeIndex Parser::ParseDoWhile() {
+		const std::uint32_t token = m_Index;
+		Next();
+		SkipEOLs();
+
+		const NodeIndex body = ParseBlock();
+		SkipEOLs();
+		Expect(TokenType::WhileKeyword);
+
+		const NodeIndex condition = ParseExpression();
+		return m_Tree->Add(NodeKind::DoWhile, token, body, condition);
+	}
+	ast::NodeIndex Parser::ParseFor() {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		NodeIndex initialization = NoNode;
+		if (m_Type == TokenType::VarKeyword || m_Type == TokenType::LetKeyword) {
+			initialization = ParseVariableDecl();
+		} else if (m_Type != TokenType::Semicolon) {
+			initialization = ParseExpression();
+		}
+		Expect(TokenType::Semicolon);
+
+		const NodeIndex condition = m_Type != TokenType::Semicolon ? ParseExpression() : NoNode;
+		Expect(TokenType::Semicolon);
+
+		const NodeIndex step = m_Type != TokenType::LeftBrace && m_Type != TokenType::EOL ? ParseExpression() : NoNode;
+		SkipEOLs();
+
+		const NodeIndex body = ParseBlock();
+		return m_Tree->AddRecord(NodeKind::For, token, 0, { initialization, condition, step, body });
+	}
+	ast::NodeIndex Parser::ParseJump(ast::NodeKind kind, bool hasOperand) {
+		const std::uint32_t token = m_Index;
+		Next();
+
+		const NodeIndex operand = hasOperand && !IsStatementEnd(m_Type) ? ParseExpression() : NoNode;
+		return m_Tree->Add(kind, token, operand);
+	}
+	bool Parser::ExpectStatementEnd() {
+		switch (m_Type) {
+		case TokenType::EOL:
+		case TokenType::Semicolon:
+			Next();
+			return true;
+
+		case TokenType::RightBrace:
+		case TokenType::None:
+			return true;
+
+		default:
+			AddError<DiagnosticId::ExpectedStatementEnd>(GetTokenDescription(m_Type));
+			Synchronize();
+			return false;
+		}
+	}
+
+	ast::NodeIndex Parser::ParseExpression(int minPrecedence) {
+		if (!Enter()) return AddErrorNode();
+
+		NodeIndex lhs = ParsePrefix();
+		int precedence;
+		while (!m_IsRecovering && (precedence = ToInt(GetInfixPrecedence(m_Type))) >= minPrecedence) {
+			lhs = ParseInfix(lhs, precedence);
+		}
+
+		Leave();
+		return lhs;
+	}
+	ast::NodeIndex Parser::ParsePrefix() {
+		const std::uint32_t token = m_Index;
+		switch (m_Type) {
+		case TokenType::Identifer:
+			return ParseIdentifier();
+
+		case TokenType::LowerSelfKeyword:
+		case TokenType::UpperSelfKeyword: {
+			const Atom name = Interner::GetKeywordAtom(m_Type);
+			Next();
+			return m_Tree->AddIdentifier(token, name);
+		}
+
+		case TokenType::BinInteger:
+		case TokenType::OctInteger:
+		case TokenType::DecInteger:
+		case TokenType::HexInteger:
+			Next();
+			return m_Tree->Add(NodeKind::IntegerLiteral, token);
+
+		case TokenType::Decimal:
+			Next();
+			return m_Tree->Add(NodeKind::DecimalLiteral, token);
+
+		case TokenType::Character:
+			Next();
+			return m_Tree->Add(NodeKind::CharacterLiteral, token);
+
+		case TokenType::String:
+			Next();
+			return m_Tree->Add(NodeKind::StringLiteral, token);
+
+		case TokenType::TrueKeyword:
+		case TokenType::FalseKeyword:
+			Next();
+			return m_Tree->Add(NodeKind::BooleanLiteral, token);
+
+		case TokenType::NullKeyword:
+			Next();
+			return m_Tree->Add(NodeKind::NullLiteral, token);
+
+		case TokenType::LeftParen:
+			return ParseGroup(NodeKind::Tuple, TokenType::RightParen);
+
+		case TokenType::LeftBigParen:
+			return ParseGroup(NodeKind::Array, TokenType::RightBigParen);
+
+		case TokenType::Plus:
+		case TokenType::Minus:
+		case TokenType::Not:
+		case TokenType::BitNot:
+		case TokenType::Increment:
+		case TokenType::Decrement:
+		case TokenType::SizeOfKeyword:
+		case TokenType::TypeOfKeyword: {
+			Next();
+			SkipEOLs();
+
+			const NodeIndex operand = ParseExpression(ToInt(Precedence::Prefix));
+			return m_Tree->Add(NodeKind::Prefix, token, operand);
+		}
+
+		case TokenType::NewKeyword: {
+			Next();
+
+			const NodeIndex type = ParseType();
+			if (m_Type == TokenType::LeftParen) return ParseCall(NodeKind::New, token, type);
+			else return m_Tree->AddList(NodeKind::New, token, &type, 1);
+		}
+
+		default:
+			if (IsBuiltinType(m_Type)) {
+				Next();
+				return m_Tree->Add(NodeKind::BuiltinType, token);
+			}
+
+			AddError<DiagnosticId::ExpectedExpression>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+	}
+	ast::NodeIndex Parser::ParseInfix(ast::NodeIndex lhs, int precedence) {
+		const std::uint32_t token = m_Index;
+		const TokenType type = m_Type;
+		switch (type) {
+		case TokenType::LeftParen:
+			return ParseCall(NodeKind::Call, token, lhs);
+
+		case TokenType::LeftBigParen: {
+			const std::size_t parenDepth = m_ParenDepth;
+			m_ParenDepth = parenDepth + 1;
+			Next();
+
+			const NodeIndex index = ParseExpression();
+			m_ParenDepth = parenDepth;
+			Expect(TokenType::RightBigParen);
+			return m_Tree->Add(NodeKind::Index, token, lhs, index);
+		}
+
+		case TokenType::Dot: {
+			Next();
+			if (m_Type != TokenType::Identifer) {
+				AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+				return m_Tree->Add(NodeKind::Member, token, lhs, NoAtom);
+			}
+
+			const Atom name = CurrentAtom();
+			Next();
+			return m_Tree->Add(NodeKind::Member, token, lhs, name);
+		}
+
+		case TokenType::Increment:
+		case TokenType::Decrement:
+			Next();
+			return m_Tree->Add(NodeKind::Postfix, token, lhs);
+
+		case TokenType::Question: {
+			Next();
+			SkipEOLs();
+
+			const NodeIndex then = ParseExpression(ToInt(Precedence::Assignment));
+			SkipEOLs();
+			Expect(TokenType::Colon);
+			SkipEOLs();
+
+			const NodeIndex otherwise = ParseExpression(ToInt(Precedence::Conditional));
+			return m_Tree->AddRecord(NodeKind::Conditional, token, 0, { lhs, then, otherwise });
+		}
+
+		case TokenType::IsKeyword:
+		case TokenType::AsKeyword: {
+			Next();
+
+			const NodeIndex rhs = ParseType();
+			return m_Tree->Add(type == TokenType::IsKeyword ? NodeKind::TypeCheck : NodeKind::Cast, token, lhs, rhs);
+		}
+
+		case TokenType::RightwardsDoubleArrow: {
+			Next();
+			SkipEOLs();
+
+			const NodeIndex body = m_Type == TokenType::LeftBrace ? ParseBlock() : ParseExpression(ToInt(Precedence::Assignment));
+			return m_Tree->Add(NodeKind::Lambda, token, lhs, body);
+		}
+
+		default: {
+			Next();
+			SkipEOLs();
+
+			const NodeIndex rhs = ParseExpression(IsRightAssociative(type) ? precedence : precedence + 1);
+			return m_Tree->Add(IsAssignment(type) ? NodeKind::Assign : NodeKind::Binary, token, lhs, rhs);
+		}
+		}
+	}
+	ast::NodeIndex Parser::ParseGroup(ast::NodeKind kind, TokenType close) {
+		const std::uint32_t token = m_Index;
+		const std::size_t parenDepth = m_ParenDepth;
+		m_ParenDepth = parenDepth + 1;
+		Next();
+
+		const std::size_t begin = m_Scratch.size();
+		bool hasComma = false;
+		while (m_Type != close) {
+			const NodeIndex element = ParseExpression();
+			m_Scratch.push_back(element);
+			if (!Accept(TokenType::Comma)) break;
+			hasComma = true;
+		}
+		m_ParenDepth = parenDepth;
+		Expect(close);
+
+		if (kind == NodeKind::Tuple && !hasComma && m_Scratch.size() - begin == 1) {
+			const NodeIndex inner = m_Scratch.back();
+			m_Scratch.pop_back();
+			return inner;
+		}
+		return AddList(kind, token, begin);
+	}
+	ast::NodeIndex Parser::ParseCall(ast::NodeKind kind, std::uint32_t token, ast::NodeIndex first) {
+		const std::size_t parenDepth = m_ParenDepth;
+		const std::size_t begin = m_Scratch.size();
+		m_Scratch.push_back(first);
+		m_ParenDepth = parenDepth + 1;
+		Next();
+
+		while (m_Type != TokenType::RightParen) {
+			const NodeIndex argument = ParseExpression();
+			m_Scratch.push_back(argument);
+			if (!Accept(TokenType::Comma)) break;
+		}
+		m_ParenDepth = parenDepth;
+		Expect(TokenType::RightParen);
+
+		return AddList(kind, token, begin);
+	}
+	ast::NodeIndex Parser::ParseType() {
+		NodeIndex type;
+		if (IsBuiltinType(m_Type)) {
+			type = m_Tree->Add(NodeKind::BuiltinType, m_Index);
+			Next();
+		} else if (m_Type == TokenType::Identifer) {
+			type = ParseQualifiedName();
+		} else if (m_Type == TokenType::UpperSelfKeyword) {
+			type = m_Tree->AddIdentifier(m_Index, Interner::GetKeywordAtom(m_Type));
+			Next();
+		} else {
+			AddError<DiagnosticId::ExpectedType>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+
+		while (m_Type == TokenType::LeftBigParen) {
+			const std::uint32_t token = m_Index;
+			Next();
+			Expect(TokenType::RightBigParen);
+			type = m_Tree->Add(NodeKind::ArrayType, token, type);
+		}
+		return type;
+	}
+	ast::NodeIndex Parser::ParseQualifiedName() {
+		NodeIndex name = ParseIdentifier();
+		while (m_Type == TokenType::Dot) {
+			const std::uint32_t token = m_Index;
+			Next();
+			if (m_Type != TokenType::Identifer) {
+				AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+				break;
+			}
+
+			name = m_Tree->Add(NodeKind::Member, token, name, CurrentAtom());
+			Next();
+		}
+		return name;
+	}
+	ast::NodeIndex Parser::ParseIdentifier() {
+		if (m_Type != TokenType::Identifer) {
+			AddError<DiagnosticId::ExpectedIdentifier>(GetTokenDescription(m_Type));
+			return AddErrorNode();
+		}
+
+		const NodeIndex identifier = m_Tree->AddIdentifier(m_Index, CurrentAtom());
+		Next();
+		return identifier;
+	}
+
+	bool Parser::Expect(TokenType type) {
+		if (Accept(type)) return true;
+
+		AddError<DiagnosticId::ExpectedToken>(GetTokenTypeWord(type), GetTokenDescription(m_Type));
+		return false;
+	}
+	Atom Parser::CurrentAtom() {
+		const Atom atom = m_Lexer == nullptr ? m_Tokens->Atom(m_Index) : m_Token.Atom();
+		if (atom != NoAtom || m_Interner == nullptr) return atom;
+		else return m_Interner->Intern(m_Lexer == nullptr ? m_Tokens->Word(m_Index) : m_Token.Word());
+	}
+	ast::NodeIndex Parser::AddList(ast::NodeKind kind, std::uint32_t token, std::size_t scratchBegin) {
+		const NodeIndex node = m_Tree->AddList(kind, token, m_Scratch.data() + scratchBegin, m_Scratch.size() - scratchBegin);
+		m_Scratch.resize(scratchBegin);
+		return node;
+	}
+	bool Parser::Enter() {
+		if (m_Depth == MaxDepth) {
+			AddError<DiagnosticId::NestingTooDeep>();
+			return false;
+		}
+
+		++m_Depth;
+		return true;
+	}
+	void Parser::Leave() noexcept {
+		--m_Depth;
+	}
+
+	ast::NodeIndex Parser::AddErrorNode() {
+		return m_Tree->Add(NodeKind::Error, m_Index);
+	}
+	void Parser::Synchronize() {
+		std::size_t braceDepth = 0;
+		while (m_Type != TokenType::None) {
+			if (m_Type == TokenType::LeftBrace) {
+				++braceDepth;
+			} else if (m_Type == TokenType::RightBrace) {
+				if (braceDepth == 0) break;
+				--braceDepth;
+			} else if (braceDepth == 0 && (m_Type == TokenType::EOL || m_Type == TokenType::Semicolon)) {
+				Next();
+				break;
+			}
+			Next();
+		}
+		m_IsRecovering = false;
+	}
+	std::uint32_t Parser::SourceId() {
+		if (m_Source == NoSource) {
+			m_Source = m_Messages->AddSource(*m_SourceName);
+		}
+		return m_Source;
+	}
+
+	template<DiagnosticId Id, typename... Arguments>
+	void Parser::AddError(const Arguments&... arguments) {
+		m_HasError = true;
+		if (m_IsRecovering || m_ErrorIndex == m_Index) return;
+		m_IsRecovering = true;
+		m_ErrorIndex = m_Index;
+
+		if (m_Lexer != nullptr) {
+			m_Messages->AddError(Id, SourceId(), m_Token.Line(), m_Token.Column(), { MessageArgument(arguments)... });
+			return;
+		} else if (m_TokenCount == 0) {
+			m_Messages->AddError(Id, SourceId());
+			return;
+		}
+
+		const std::size_t index = std::min<std::size_t>(m_Index, m_TokenCount - 1);
+		const std::string_view source = m_Tokens->Source();
+		const std::size_t column = m_Tokens->Column(index);
+		const std::size_t lineBegin = m_Tokens->Offset(index) - column;
+		std::size_t lineEnd = std::min(source.find('\n', lineBegin), source.size());
+		if (lineEnd > lineBegin && source[lineEnd - 1] == '\r') {
+			--lineEnd;
+		}
+
+		m_Messages->AddError<Id>(SourceId(), m_Tokens->Line(index), column, std::max<std::size_t>(m_Tokens->Word(index).size(), 1),
+								 source.substr(lineBegin, lineEnd - lineBegin), arguments...);
+	}
+}
\ No newline at end of file
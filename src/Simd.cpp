@@ -0,0 +1,326 @@
+#include <ice/Simd.hpp>
+
+#include <ice/Encoding.hpp>
+#include <ice/detail/Config.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef ISX64
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#endif
+
+namespace {
+	bool IsIdentifierCharacter(char c) noexcept {
+		return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+	}
+
+	std::size_t SkipWhitespacesScalar(std::string_view source, std::size_t begin) noexcept {
+		while (begin < source.size() && (source[begin] == ' ' || source[begin] == '\t')) ++begin;
+		return begin;
+	}
+	std::size_t SkipIdentifierCharactersScalar(std::string_view source, std::size_t begin) noexcept {
+		while (begin < source.size() && IsIdentifierCharacter(source[begin])) ++begin;
+		return begin;
+	}
+	std::size_t FindCharacterScalar(std::string_view source, std::size_t begin, char character) noexcept {
+		while (begin < source.size() && source[begin] != character) ++begin;
+		return begin;
+	}
+	std::size_t FindNonASCIIScalar(std::string_view source, std::size_t begin) noexcept {
+		for (; begin + sizeof(std::uint64_t) <= source.size(); begin += sizeof(std::uint64_t)) {
+			std::uint64_t word;
+			std::memcpy(&word, source.data() + begin, sizeof(word));
+			if ((word & 0x8080808080808080) != 0) break;
+		}
+		while (begin < source.size() && static_cast<unsigned char>(source[begin]) < 0x80) ++begin;
+		return begin;
+	}
+	std::size_t FindInvalidUTF8Scalar(std::string_view source, std::size_t begin) noexcept {
+		while ((begin = FindNonASCIIScalar(source, begin)) < source.size()) {
+			const int length = ice::GetValidCodepointLength(source, begin);
+			if (length == 0) break;
+			begin += length;
+		}
+		return begin;
+	}
+	std::size_t FindInvalidUTF8From(std::string_view source, std::size_t begin, std::size_t blockBegin) noexcept {
+		for (std::size_t i = 1; i <= 3 && blockBegin >= begin + i; ++i) {
+			if ((static_cast<unsigned char>(source[blockBegin - i]) & 0xC0) != 0x80) return FindInvalidUTF8Scalar(source, blockBegin - i);
+		}
+		return FindInvalidUTF8Scalar(source, blockBegin);
+	}
+}
+
+#ifdef ISX64
+namespace {
+	int CountTrailingZeros(unsigned int mask) noexcept {
+#ifdef _MSC_VER
+		unsigned long result;
+		_BitScanForward(&result, mask);
+		return static_cast<int>(result);
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+	__m128i IsInRange(__m128i chunk, char min, char max) noexcept {
+		const __m128i offset = _mm_sub_epi8(chunk, _mm_set1_epi8(min));
+		return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(static_cast<char>(max - min))), offset);
+	}
+	__m128i IsIdentifierCharacter(__m128i chunk) noexcept {
+		const __m128i letter = IsInRange(_mm_or_si128(chunk, _mm_set1_epi8(0x20)), 'a', 'z');
+		const __m128i digit = IsInRange(chunk, '0', '9');
+		const __m128i underscore = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+		return _mm_or_si128(_mm_or_si128(letter, digit), underscore);
+	}
+
+	std::size_t SkipWhitespacesSSE2(std::string_view source, std::size_t begin) noexcept {
+		const __m128i space = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+		for (; begin + 16 <= source.size(); begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + begin));
+			const unsigned int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab))) ^ 0xFFFF;
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		return SkipWhitespacesScalar(source, begin);
+	}
+	std::size_t SkipIdentifierCharactersSSE2(std::string_view source, std::size_t begin) noexcept {
+		for (; begin + 16 <= source.size(); begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + begin));
+			const unsigned int mask = _mm_movemask_epi8(IsIdentifierCharacter(chunk)) ^ 0xFFFF;
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		return SkipIdentifierCharactersScalar(source, begin);
+	}
+	std::size_t FindCharacterSSE2(std::string_view source, std::size_t begin, char character) noexcept {
+		const __m128i target = _mm_set1_epi8(character);
+		for (; begin + 16 <= source.size(); begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + begin));
+			const unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, target));
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		return FindCharacterScalar(source, begin, character);
+	}
+	std::size_t FindNonASCIISSE2(std::string_view source, std::size_t begin) noexcept {
+		for (; begin + 16 <= source.size(); begin += 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + begin));
+			const unsigned int mask = _mm_movemask_epi8(chunk);
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		return FindNonASCIIScalar(source, begin);
+	}
+	std::size_t FindInvalidUTF8SSE2(std::string_view source, std::size_t begin) noexcept {
+		while ((begin = FindNonASCIISSE2(source, begin)) < source.size()) {
+			const int length = ice::GetValidCodepointLength(source, begin);
+			if (length == 0) break;
+			begin += length;
+		}
+		return begin;
+	}
+
+	ISTARGET("avx2") __m256i IsInRange(__m256i chunk, char min, char max) noexcept {
+		const __m256i offset = _mm256_sub_epi8(chunk, _mm256_set1_epi8(min));
+		return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(static_cast<char>(max - min))), offset);
+	}
+	ISTARGET("avx2") __m256i IsIdentifierCharacter(__m256i chunk) noexcept {
+		const __m256i letter = IsInRange(_mm256_or_si256(chunk, _mm256_set1_epi8(0x20)), 'a', 'z');
+		const __m256i digit = IsInRange(chunk, '0', '9');
+		const __m256i underscore = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_'));
+		return _mm256_or_si256(_mm256_or_si256(letter, digit), underscore);
+	}
+
+	ISTARGET("avx2") std::size_t SkipWhitespacesAVX2(std::string_view source, std::size_t begin) noexcept {
+		const __m256i space = _mm256_set1_epi8(' ');
+		const __m256i tab = _mm256_set1_epi8('\t');
+		for (; begin + 32 <= source.size(); begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + begin));
+			const unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab))));
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		_mm256_zeroupper();
+		return SkipWhitespacesSSE2(source, begin);
+	}
+	ISTARGET("avx2") std::size_t SkipIdentifierCharactersAVX2(std::string_view source, std::size_t begin) noexcept {
+		for (; begin + 32 <= source.size(); begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + begin));
+			const unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(IsIdentifierCharacter(chunk)));
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		_mm256_zeroupper();
+		return SkipIdentifierCharactersSSE2(source, begin);
+	}
+	ISTARGET("avx2") std::size_t FindCharacterAVX2(std::string_view source, std::size_t begin, char character) noexcept {
+		const __m256i target = _mm256_set1_epi8(character);
+		for (; begin + 32 <= source.size(); begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + begin));
+			const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, target)));
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		_mm256_zeroupper();
+		return FindCharacterSSE2(source, begin, character);
+	}
+
+	ISTARGET("avx2") std::size_t FindNonASCIIAVX2(std::string_view source, std::size_t begin) noexcept {
+		for (; begin + 32 <= source.size(); begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + begin));
+			const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(chunk));
+			if (mask != 0) return begin + CountTrailingZeros(mask);
+		}
+		_mm256_zeroupper();
+		return FindNonASCIISSE2(source, begin);
+	}
+
+	constexpr std::uint8_t s_TooShort = 1 << 0;
+	constexpr std::uint8_t s_TooLong = 1 << 1;
+	constexpr std::uint8_t s_Overlong3 = 1 << 2;
+	constexpr std::uint8_t s_TooLarge = 1 << 3;
+	constexpr std::uint8_t s_Surrogate = 1 << 4;
+	constexpr std::uint8_t s_Overlong2 = 1 << 5;
+	constexpr std::uint8_t s_TooLarge1000 = 1 << 6;
+	constexpr std::uint8_t s_Overlong4 = 1 << 6;
+	constexpr std::uint8_t s_TwoContinuations = 1 << 7;
+	constexpr std::uint8_t s_Carry = s_TooShort | s_TooLong | s_TwoContinuations;
+
+	ISTARGET("avx2") __m256i Lookup(__m256i indices, std::uint8_t i0, std::uint8_t i1, std::uint8_t i2, std::uint8_t i3,
+									std::uint8_t i4, std::uint8_t i5, std::uint8_t i6, std::uint8_t i7,
+									std::uint8_t i8, std::uint8_t i9, std::uint8_t i10, std::uint8_t i11,
+									std::uint8_t i12, std::uint8_t i13, std::uint8_t i14, std::uint8_t i15) noexcept {
+		const __m256i table = _mm256_setr_epi8(
+			i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+			i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15);
+		return _mm256_shuffle_epi8(table, indices);
+	}
+	ISTARGET("avx2") __m256i GetHighNibbles(__m256i chunk) noexcept {
+		return _mm256_and_si256(_mm256_srli_epi16(chunk, 4), _mm256_set1_epi8(0x0F));
+	}
+	template<int N>
+	ISTARGET("avx2") __m256i GetPrevious(__m256i chunk, __m256i previousChunk) noexcept {
+		return _mm256_alignr_epi8(chunk, _mm256_permute2x128_si256(previousChunk, chunk, 0x21), 16 - N);
+	}
+	ISTARGET("avx2") __m256i CheckUTF8Bytes(__m256i chunk, __m256i previousChunk) noexcept {
+		const __m256i previous1 = GetPrevious<1>(chunk, previousChunk);
+		const __m256i byte1High = Lookup(GetHighNibbles(previous1),
+			s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong, s_TooLong,
+			s_TwoContinuations, s_TwoContinuations, s_TwoContinuations, s_TwoContinuations,
+			s_TooShort | s_Overlong2,
+			s_TooShort,
+			s_TooShort | s_Overlong3 | s_Surrogate,
+			s_TooShort | s_TooLarge | s_TooLarge1000 | s_Overlong4);
+		const __m256i byte1Low = Lookup(_mm256_and_si256(previous1, _mm256_set1_epi8(0x0F)),
+			s_Carry | s_Overlong3 | s_Overlong2 | s_Overlong4,
+			s_Carry | s_Overlong2,
+			s_Carry,
+			s_Carry,
+			s_Carry | s_TooLarge,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000 | s_Surrogate,
+			s_Carry | s_TooLarge | s_TooLarge1000,
+			s_Carry | s_TooLarge | s_TooLarge1000);
+		const __m256i byte2High = Lookup(GetHighNibbles(chunk),
+			s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort, s_TooShort,
+			s_TooLong | s_Overlong2 | s_TwoContinuations | s_Overlong3 | s_TooLarge1000 | s_Overlong4,
+			s_TooLong | s_Overlong2 | s_TwoContinuations | s_Overlong3 | s_TooLarge,
+			s_TooLong | s_Overlong2 | s_TwoContinuations | s_Surrogate | s_TooLarge,
+			s_TooLong | s_Overlong2 | s_TwoContinuations | s_Surrogate | s_TooLarge,
+			s_TooShort, s_TooShort, s_TooShort, s_TooShort);
+		const __m256i specialCases = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+		const __m256i isThirdByte = _mm256_subs_epu8(GetPrevious<2>(chunk, previousChunk), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+		const __m256i isFourthByte = _mm256_subs_epu8(GetPrevious<3>(chunk, previousChunk), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+		const __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+		return _mm256_xor_si256(mustBeContinuation, specialCases);
+	}
+	ISTARGET("avx2") __m256i IsIncomplete(__m256i chunk) noexcept {
+		const __m256i maxValue = _mm256_setr_epi8(
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+		return _mm256_subs_epu8(chunk, maxValue);
+	}
+	ISTARGET("avx2") std::size_t FindInvalidUTF8AVX2(std::string_view source, std::size_t begin) noexcept {
+		const std::size_t validationBegin = begin;
+		__m256i previousChunk = _mm256_setzero_si256();
+		__m256i previousIncomplete = _mm256_setzero_si256();
+
+		for (; begin + 32 <= source.size(); begin += 32) {
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + begin));
+			__m256i error;
+			if (_mm256_movemask_epi8(chunk) == 0) {
+				error = previousIncomplete;
+			} else {
+				error = CheckUTF8Bytes(chunk, previousChunk);
+				previousIncomplete = IsIncomplete(chunk);
+			}
+			if (!_mm256_testz_si256(error, error)) {
+				_mm256_zeroupper();
+				return FindInvalidUTF8From(source, validationBegin, begin);
+			}
+			previousChunk = chunk;
+		}
+		_mm256_zeroupper();
+		return FindInvalidUTF8From(source, validationBegin, begin);
+	}
+
+	bool IsAVX2Supported() noexcept {
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 1);
+		if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6) return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+}
+#endif
+
+namespace {
+	struct Kernels final {
+		std::size_t(*SkipWhitespaces)(std::string_view, std::size_t) noexcept;
+		std::size_t(*SkipIdentifierCharacters)(std::string_view, std::size_t) noexcept;
+		std::size_t(*FindCharacter)(std::string_view, std::size_t, char) noexcept;
+		std::size_t(*FindNonASCII)(std::string_view, std::size_t) noexcept;
+		std::size_t(*FindInvalidUTF8)(std::string_view, std::size_t) noexcept;
+	};
+
+	Kernels SelectKernels() noexcept {
+#ifdef ISX64
+		if (IsAVX2Supported()) return { SkipWhitespacesAVX2, SkipIdentifierCharactersAVX2, FindCharacterAVX2, FindNonASCIIAVX2, FindInvalidUTF8AVX2 };
+		else return { SkipWhitespacesSSE2, SkipIdentifierCharactersSSE2, FindCharacterSSE2, FindNonASCIISSE2, FindInvalidUTF8SSE2 };
+#else
+		return { SkipWhitespacesScalar, SkipIdentifierCharactersScalar, FindCharacterScalar, FindNonASCIIScalar, FindInvalidUTF8Scalar };
+#endif
+	}
+
+	const Kernels s_Kernels = SelectKernels();
+}
+
+namespace ice {
+	std::size_t SkipWhitespaces(std::string_view source, std::size_t begin) noexcept {
+		return s_Kernels.SkipWhitespaces(source, begin);
+	}
+	std::size_t SkipIdentifierCharacters(std::string_view source, std::size_t begin) noexcept {
+		return s_Kernels.SkipIdentifierCharacters(source, begin);
+	}
+	std::size_t FindCharacter(std::string_view source, std::size_t begin, char character) noexcept {
+		return s_Kernels.FindCharacter(source, begin, character);
+	}
+	std::size_t FindNonASCII(std::string_view source, std::size_t begin) noexcept {
+		return s_Kernels.FindNonASCII(source, begin);
+	}
+	std::size_t FindInvalidUTF8(std::string_view source, std::size_t begin) noexcept {
+		return s_Kernels.FindInvalidUTF8(source, begin);
+	}
+}
\ No newline at end of file
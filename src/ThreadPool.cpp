@@ -0,0 +1,121 @@
+#include <ice/ThreadPool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+	thread_local const ice::ThreadPool* s_CurrentPool = nullptr;
+	thread_local std::size_t s_CurrentWorker = 0;
+}
+
+namespace ice {
+	ThreadPool::ThreadPool(std::size_t threadCount) {
+		threadCount = std::max<std::size_t>(threadCount, 1);
+
+		m_Workers.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i) {
+			m_Workers.push_back(std::make_unique<Worker>());
+		}
+
+		m_Threads.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i) {
+			m_Threads.emplace_back(&ThreadPool::Run, this, i);
+		}
+	}
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_IsStopping = true;
+		}
+		m_Condition.notify_all();
+
+		for (std::thread& thread : m_Threads) {
+			thread.join();
+		}
+	}
+
+	std::size_t ThreadPool::Size() const noexcept {
+		return m_Workers.size();
+	}
+	void ThreadPool::Submit(Task task) {
+		const std::size_t index = s_CurrentPool == this ? s_CurrentWorker : m_NextWorker.fetch_add(1, std::memory_order_relaxed) % m_Workers.size();
+
+		m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+		{
+			Worker& worker = *m_Workers[index];
+			std::lock_guard<std::mutex> lock(worker.Mutex);
+			worker.Tasks.push_back(std::move(task));
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_QueuedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		m_Condition.notify_one();
+	}
+	void ThreadPool::Wait() {
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_IdleCondition.wait(lock, [this] { return m_PendingCount.load(std::memory_order_acquire) == 0; });
+	}
+	void ThreadPool::Wait(const std::atomic<std::size_t>& pendingCount) {
+		const std::size_t index = s_CurrentPool == this ? s_CurrentWorker : 0;
+
+		Task task;
+		while (pendingCount.load(std::memory_order_acquire) != 0) {
+			if (Pop(index, task) || Steal(index, task)) {
+				m_QueuedCount.fetch_sub(1, std::memory_order_relaxed);
+				task();
+				task = nullptr;
+				Finish();
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void ThreadPool::Run(std::size_t index) {
+		s_CurrentPool = this;
+		s_CurrentWorker = index;
+
+		Task task;
+		while (true) {
+			if (Pop(index, task) || Steal(index, task)) {
+				m_QueuedCount.fetch_sub(1, std::memory_order_relaxed);
+				task();
+				task = nullptr;
+				Finish();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Condition.wait(lock, [this] { return m_IsStopping || m_QueuedCount.load(std::memory_order_relaxed) != 0; });
+			if (m_IsStopping && m_QueuedCount.load(std::memory_order_relaxed) == 0) break;
+		}
+	}
+	bool ThreadPool::Pop(std::size_t index, Task& task) {
+		Worker& worker = *m_Workers[index];
+		std::lock_guard<std::mutex> lock(worker.Mutex);
+		if (worker.Tasks.empty()) return false;
+
+		task = std::move(worker.Tasks.back());
+		worker.Tasks.pop_back();
+		return true;
+	}
+	bool ThreadPool::Steal(std::size_t index, Task& task) {
+		for (std::size_t i = 1; i < m_Workers.size(); ++i) {
+			Worker& victim = *m_Workers[(index + i) % m_Workers.size()];
+			std::unique_lock<std::mutex> lock(victim.Mutex, std::try_to_lock);
+			if (!lock.owns_lock() || victim.Tasks.empty()) continue;
+
+			task = std::move(victim.Tasks.front());
+			victim.Tasks.pop_front();
+			return true;
+		}
+		return false;
+	}
+	void ThreadPool::Finish() {
+		if (m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_IdleCondition.notify_all();
+	}
+}
\ No newline at end of file
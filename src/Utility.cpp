@@ -1,28 +1,44 @@
 #include <ice/Utility.hpp>
 
 namespace ice {
-	std::string Format(const std::string& format, const std::vector<std::string>& arguments) {
-		std::string result;
-
+	void VFormatTo(std::string& result, std::string_view format, std::size_t argumentCount, FormatArgumentAppender appender, const void* context) {
 		std::size_t begin = 0;
 		std::size_t percent;
 		std::size_t index = 0;
 
-		while ((percent = format.find('%', begin)) != std::string::npos) {
-			result.insert(result.end(), format.begin() + begin, format.begin() + percent);
+		while ((percent = format.find('%', begin)) != std::string_view::npos) {
+			result.append(format.data() + begin, percent - begin);
 			if (percent + 1 < format.size() && format[percent + 1] == '%') {
 				result.push_back('%');
 				begin = percent + 2;
 			} else {
-				result.append(arguments[index++]);
+				if (index < argumentCount) {
+					appender(result, index++, context);
+				}
 				begin = percent + 1;
 			}
 		}
 
 		if (begin < format.size()) {
-			result.insert(result.end(), format.begin() + begin, format.end());
+			result.append(format.data() + begin, format.size() - begin);
 		}
+	}
 
-		return result;
+	void AppendFormatArgument(std::string& result, char argument) {
+		result.push_back(argument);
+	}
+	void AppendFormatArgument(std::string& result, bool argument) {
+		result.append(argument ? "true" : "false");
+	}
+	void AppendFormatArgument(std::string& result, const char* argument) {
+		if (argument) {
+			result.append(argument);
+		}
+	}
+	void AppendFormatArgument(std::string& result, std::string_view argument) {
+		result.append(argument);
+	}
+	void AppendFormatArgument(std::string& result, const std::string& argument) {
+		result.append(argument);
 	}
 }
\ No newline at end of file
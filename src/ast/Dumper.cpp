@@ -0,0 +1,157 @@
+#include <ice/ast/Dumper.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace {
+	using ice::ast::NodeKind;
+
+	std::string_view GetSlotName(NodeKind parentKind, std::uint32_t slot) noexcept {
+		static constexpr std::string_view declNames[] = { "Type", "Initialization" };
+		static constexpr std::string_view functionNames[] = { "Parameters", "ReturnType", "Body" };
+		static constexpr std::string_view ifNames[] = { "Condition", "Then", "Else" };
+		static constexpr std::string_view forNames[] = { "Initialization", "Condition", "Step", "Body" };
+
+		switch (parentKind) {
+		case NodeKind::VariableDecl:
+		case NodeKind::Parameter: return declNames[slot];
+		case NodeKind::FunctionDecl: return functionNames[slot];
+		case NodeKind::If:
+		case NodeKind::Conditional: return ifNames[slot];
+		case NodeKind::While: return slot == 0 ? "Condition" : "Body";
+		case NodeKind::DoWhile: return slot == 0 ? "Body" : "Condition";
+		case NodeKind::For: return forNames[slot];
+		case NodeKind::Call: return slot == 0 ? "Callee" : "";
+		case NodeKind::New: return slot == 0 ? "Type" : "";
+		case NodeKind::Lambda: return slot == 0 ? "Parameters" : "Body";
+		case NodeKind::Cast:
+		case NodeKind::TypeCheck: return slot == 0 ? "" : "Type";
+		default: return {};
+		}
+	}
+	bool HasSpelling(NodeKind kind) noexcept {
+		switch (kind) {
+		case NodeKind::IntegerLiteral:
+		case NodeKind::DecimalLiteral:
+		case NodeKind::CharacterLiteral:
+		case NodeKind::StringLiteral:
+		case NodeKind::BooleanLiteral:
+		case NodeKind::Prefix:
+		case NodeKind::Postfix:
+		case NodeKind::Binary:
+		case NodeKind::Assign:
+		case NodeKind::BuiltinType:
+			return true;
+
+		default:
+			return false;
+		}
+	}
+}
+
+namespace ice::ast {
+	Dumper::Dumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize)
+		: m_Stream(&stream), m_Interner(&interner), m_BufferSize(bufferSize) {
+		m_Buffer.reserve(bufferSize);
+	}
+	Dumper::~Dumper() {
+		Flush();
+	}
+
+	void Dumper::Begin() {
+	}
+	const TokenBuffer* Dumper::Tokens() const noexcept {
+		return m_Tokens;
+	}
+	void Dumper::Tokens(const TokenBuffer* newTokens) noexcept {
+		m_Tokens = newTokens;
+	}
+	void Dumper::Dump(const Tree& tree) {
+		Dump(tree, tree.Root());
+	}
+	void Dumper::Dump(const Tree& tree, NodeIndex root) {
+		Begin();
+		m_Walker.Walk(tree, root, *this);
+		Flush();
+	}
+	void Dumper::Flush() {
+		if (!m_Buffer.empty()) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+		m_Stream->flush();
+	}
+
+	void Dumper::Commit() {
+		if (m_Buffer.size() >= m_BufferSize) {
+			m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+	}
+}
+
+namespace ice::ast {
+	TextDumper::TextDumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize)
+		: Dumper(stream, interner, bufferSize) {
+	}
+
+	bool TextDumper::Enter(const Tree& tree, const VisitContext& context) {
+		m_Buffer.append(static_cast<std::size_t>(context.Depth) * 4, ' ');
+		if (context.Parent != NoNode) {
+			const std::string_view slotName = GetSlotName(tree.Kind(context.Parent), context.Slot);
+			if (!slotName.empty()) {
+				m_Buffer.append(slotName).append(": ");
+			}
+		}
+
+		m_Buffer.append(GetNodeKindName(tree.Kind(context.Node)));
+
+		const Atom name = tree.Name(context.Node);
+		if (name != NoAtom) {
+			m_Buffer.append(" \"").append(m_Interner->Spelling(name)).push_back('"');
+		} else if (m_Tokens != nullptr && HasSpelling(tree.Kind(context.Node)) && tree.Token(context.Node) < m_Tokens->Size()) {
+			m_Buffer.append(1, ' ').append(m_Tokens->Word(tree.Token(context.Node)));
+		}
+
+		m_Buffer.push_back('\n');
+		Commit();
+		return true;
+	}
+}
+
+namespace ice::ast {
+	BinaryDumper::BinaryDumper(std::ostream& stream, const Interner& interner, std::size_t bufferSize)
+		: Dumper(stream, interner, bufferSize) {
+	}
+
+	void BinaryDumper::Begin() {
+		m_Buffer.append("ICEAST");
+		m_Buffer.push_back(static_cast<char>(Version));
+	}
+	bool BinaryDumper::Enter(const Tree& tree, const VisitContext& context) {
+		m_Buffer.push_back(static_cast<char>(tree.Kind(context.Node)));
+		AppendVarint(context.Depth);
+		AppendVarint(context.Slot);
+		AppendVarint(tree.Token(context.Node));
+
+		const Atom name = tree.Name(context.Node);
+		if (name == NoAtom) {
+			AppendVarint(0);
+		} else {
+			const std::string_view spelling = m_Interner->Spelling(name);
+			AppendVarint(spelling.size() + 1);
+			m_Buffer.append(spelling);
+		}
+
+		Commit();
+		return true;
+	}
+
+	void BinaryDumper::AppendVarint(std::uint64_t integer) {
+		while (integer >= 0x80) {
+			m_Buffer.push_back(static_cast<char>((integer & 0x7F) | 0x80));
+			integer >>= 7;
+		}
+		m_Buffer.push_back(static_cast<char>(integer));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include <ice/ast/Tree.hpp>
+
+#include <utility>
+
+namespace {
+	constexpr std::string_view s_NodeKindNames[] = {
+#define E(x, y) #x
+#include <ice/detail/NodeKind.txt>
+#undef E
+	};
+}
+
+namespace ice::ast {
+	std::string_view GetNodeKindName(NodeKind kind) noexcept {
+		return s_NodeKindNames[static_cast<std::size_t>(kind)];
+	}
+}
+
+namespace ice::ast {
+	Tree::Tree(const Tree& tree)
+		: m_Kinds(tree.m_Kinds), m_Tokens(tree.m_Tokens), m_Lhs(tree.m_Lhs), m_Rhs(tree.m_Rhs), m_Extra(tree.m_Extra), m_Root(tree.m_Root) {
+	}
+	Tree::Tree(Tree&& tree) noexcept
+		: m_Kinds(std::move(tree.m_Kinds)), m_Tokens(std::move(tree.m_Tokens)), m_Lhs(std::move(tree.m_Lhs)), m_Rhs(std::move(tree.m_Rhs)),
+		m_Extra(std::move(tree.m_Extra)), m_Root(tree.m_Root) {
+		tree.m_Root = NoNode;
+	}
+
+	Tree& Tree::operator=(const Tree& tree) {
+		m_Kinds = tree.m_Kinds;
+		m_Tokens = tree.m_Tokens;
+		m_Lhs = tree.m_Lhs;
+		m_Rhs = tree.m_Rhs;
+		m_Extra = tree.m_Extra;
+		m_Root = tree.m_Root;
+
+		return *this;
+	}
+	Tree& Tree::operator=(Tree&& tree) noexcept {
+		m_Kinds = std::move(tree.m_Kinds);
+		m_Tokens = std::move(tree.m_Tokens);
+		m_Lhs = std::move(tree.m_Lhs);
+		m_Rhs = std::move(tree.m_Rhs);
+		m_Extra = std::move(tree.m_Extra);
+		m_Root = tree.m_Root;
+
+		tree.m_Root = NoNode;
+
+		return *this;
+	}
+
+	void Tree::Clear() noexcept {
+		m_Kinds.clear();
+		m_Tokens.clear();
+		m_Lhs.clear();
+		m_Rhs.clear();
+		m_Extra.clear();
+		m_Root = NoNode;
+	}
+	void Tree::Reserve(std::size_t nodeCount, std::size_t extraCount) {
+		m_Kinds.reserve(nodeCount);
+		m_Tokens.reserve(nodeCount);
+		m_Lhs.reserve(nodeCount);
+		m_Rhs.reserve(nodeCount);
+		m_Extra.reserve(extraCount);
+	}
+	bool Tree::IsEmpty() const noexcept {
+		return m_Kinds.empty();
+	}
+	std::size_t Tree::Size() const noexcept {
+		return m_Kinds.size();
+	}
+	std::size_t Tree::ExtraSize() const noexcept {
+		return m_Extra.size();
+	}
+	std::size_t Tree::MemoryUsage() const noexcept {
+		return m_Kinds.size() * (sizeof(NodeKind) + sizeof(std::uint32_t) * 3) + m_Extra.size() * sizeof(std::uint32_t);
+	}
+	NodeIndex Tree::Root() const noexcept {
+		return m_Root;
+	}
+	void Tree::Root(NodeIndex newRoot) noexcept {
+		m_Root = newRoot;
+	}
+
+	NodeKind Tree::Kind(NodeIndex node) const noexcept {
+		return m_Kinds[node];
+	}
+	std::uint32_t Tree::Token(NodeIndex node) const noexcept {
+		return m_Tokens[node];
+	}
+	std::uint32_t Tree::Lhs(NodeIndex node) const noexcept {
+		return m_Lhs[node];
+	}
+	std::uint32_t Tree::Rhs(NodeIndex node) const noexcept {
+		return m_Rhs[node];
+	}
+	std::uint32_t Tree::Extra(std::size_t index) const noexcept {
+		return m_Extra[index];
+	}
+	Span<const std::uint32_t> Tree::Extra(std::size_t index, std::size_t size) const noexcept {
+		return Span<const std::uint32_t>(m_Extra.data() + index, size);
+	}
+	const std::vector<NodeKind>& Tree::Kinds() const noexcept {
+		return m_Kinds;
+	}
+	const std::vector<std::uint32_t>& Tree::Tokens() const noexcept {
+		return m_Tokens;
+	}
+	const std::vector<std::uint32_t>& Tree::Lhs() const noexcept {
+		return m_Lhs;
+	}
+	const std::vector<std::uint32_t>& Tree::Rhs() const noexcept {
+		return m_Rhs;
+	}
+	const std::vector<std::uint32_t>& Tree::Extra() const noexcept {
+		return m_Extra;
+	}
+	std::size_t Tree::ChildCount(NodeIndex node) const noexcept {
+		switch (GetNodeLayout(m_Kinds[node])) {
+		case NodeLayout::Unary: return 1;
+		case NodeLayout::Binary: return 2;
+		case NodeLayout::List: return m_Rhs[node];
+		case NodeLayout::Extra2: return 2;
+		case NodeLayout::Extra3: return 3;
+		case NodeLayout::Extra4: return 4;
+		default: return 0;
+		}
+	}
+	NodeIndex Tree::Child(NodeIndex node, std::size_t index) const noexcept {
+		switch (GetNodeLayout(m_Kinds[node])) {
+		case NodeLayout::Unary:
+		case NodeLayout::Binary:
+			return index == 0 ? m_Lhs[node] : m_Rhs[node];
+
+		case NodeLayout::List:
+			return m_Extra[m_Lhs[node] + index];
+
+		case NodeLayout::Extra2:
+		case NodeLayout::Extra3:
+		case NodeLayout::Extra4:
+			return m_Extra[m_Rhs[node] + index];
+
+		default:
+			return NoNode;
+		}
+	}
+
+	Atom Tree::Name(NodeIndex node) const noexcept {
+		switch (m_Kinds[node]) {
+		case NodeKind::VariableDecl:
+		case NodeKind::FunctionDecl:
+		case NodeKind::Parameter:
+		case NodeKind::Identifier:
+			return m_Lhs[node];
+
+		case NodeKind::Member:
+			return m_Rhs[node];
+
+		default:
+			return NoAtom;
+		}
+	}
+	Span<const NodeIndex> Tree::Elements(NodeIndex node) const noexcept {
+		if (GetNodeLayout(m_Kinds[node]) != NodeLayout::List) return {};
+		return Extra(m_Lhs[node], m_Rhs[node]);
+	}
+	NodeIndex Tree::Type(NodeIndex node) const noexcept {
+		if (m_Kinds[node] != NodeKind::VariableDecl && m_Kinds[node] != NodeKind::Parameter) return NoNode;
+		return m_Extra[m_Rhs[node]];
+	}
+	NodeIndex Tree::Initialization(NodeIndex node) const noexcept {
+		if (m_Kinds[node] != NodeKind::VariableDecl && m_Kinds[node] != NodeKind::Parameter) return NoNode;
+		return m_Extra[m_Rhs[node] + 1];
+	}
+
+	NodeIndex Tree::Add(NodeKind kind, std::uint32_t token, std::uint32_t lhs, std::uint32_t rhs) {
+		const NodeIndex node = static_cast<NodeIndex>(m_Kinds.size());
+		m_Kinds.push_back(kind);
+		m_Tokens.push_back(token);
+		m_Lhs.push_back(lhs);
+		m_Rhs.push_back(rhs);
+		return node;
+	}
+	std::uint32_t Tree::AddExtra(const std::uint32_t* data, std::size_t size) {
+		const std::uint32_t index = static_cast<std::uint32_t>(m_Extra.size());
+		m_Extra.insert(m_Extra.end(), data, data + size);
+		return index;
+	}
+	NodeIndex Tree::AddList(NodeKind kind, std::uint32_t token, const NodeIndex* children, std::size_t childCount) {
+		return Add(kind, token, AddExtra(children, childCount), static_cast<std::uint32_t>(childCount));
+	}
+	NodeIndex Tree::AddRecord(NodeKind kind, std::uint32_t token, std::uint32_t lhs, std::initializer_list<NodeIndex> children) {
+		return Add(kind, token, lhs, AddExtra(children.begin(), children.size()));
+	}
+	NodeIndex Tree::AddBlock(std::uint32_t token, const NodeIndex* statements, std::size_t statementCount) {
+		return AddList(NodeKind::Block, token, statements, statementCount);
+	}
+	NodeIndex Tree::AddVariableDecl(std::uint32_t token, Atom name, NodeIndex type, NodeIndex initialization) {
+		return AddRecord(NodeKind::VariableDecl, token, name, { type, initialization });
+	}
+	NodeIndex Tree::AddIdentifier(std::uint32_t token, Atom name) {
+		return Add(NodeKind::Identifier, token, name);
+	}
+	void Tree::Assign(const NodeKind* kinds, const std::uint32_t* tokens, const std::uint32_t* lhs, const std::uint32_t* rhs, std::size_t nodeCount,
+		const std::uint32_t* extra, std::size_t extraCount, NodeIndex root) {
+		m_Kinds.assign(kinds, kinds + nodeCount);
+		m_Tokens.assign(tokens, tokens + nodeCount);
+		m_Lhs.assign(lhs, lhs + nodeCount);
+		m_Rhs.assign(rhs, rhs + nodeCount);
+		m_Extra.assign(extra, extra + extraCount);
+		m_Root = root;
+	}
+	void Tree::RemapAtoms(const std::vector<Atom>& atoms) noexcept {
+		for (std::size_t i = 0; i < m_Kinds.size(); ++i) {
+			switch (m_Kinds[i]) {
+			case NodeKind::VariableDecl:
+			case NodeKind::FunctionDecl:
+			case NodeKind::Parameter:
+			case NodeKind::Identifier:
+				if (m_Lhs[i] != NoAtom) {
+					m_Lhs[i] = atoms[m_Lhs[i]];
+				}
+				break;
+
+			case NodeKind::Member:
+				if (m_Rhs[i] != NoAtom) {
+					m_Rhs[i] = atoms[m_Rhs[i]];
+				}
+				break;
+
+			default:
+				break;
+			}
+		}
+	}
+}
\ No newline at end of file
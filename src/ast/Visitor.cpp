@@ -0,0 +1,67 @@
+#include <ice/ast/Visitor.hpp>
+
+#include <utility>
+
+namespace ice::ast {
+	void Visitor::Leave(const Tree&, const VisitContext&) {
+	}
+}
+
+namespace ice::ast {
+	Walker::Walker(const Walker& walker)
+		: m_Frames(walker.m_Frames) {
+	}
+	Walker::Walker(Walker&& walker) noexcept
+		: m_Frames(std::move(walker.m_Frames)) {
+	}
+
+	Walker& Walker::operator=(const Walker& walker) {
+		m_Frames = walker.m_Frames;
+
+		return *this;
+	}
+	Walker& Walker::operator=(Walker&& walker) noexcept {
+		m_Frames = std::move(walker.m_Frames);
+
+		return *this;
+	}
+
+	void Walker::Walk(const Tree& tree, Visitor& visitor) {
+		Walk(tree, tree.Root(), visitor);
+	}
+	void Walker::Walk(const Tree& tree, NodeIndex root, Visitor& visitor) {
+		m_Frames.clear();
+		if (root == NoNode) return;
+
+		VisitContext context;
+		context.Node = root;
+		Push(tree, context, visitor);
+
+		while (!m_Frames.empty()) {
+			Frame& frame = m_Frames.back();
+			if (frame.NextChild == frame.ChildCount) {
+				const VisitContext leaving = frame.Context;
+				m_Frames.pop_back();
+				visitor.Leave(tree, leaving);
+				continue;
+			}
+
+			const std::uint32_t slot = frame.NextChild++;
+			const NodeIndex child = tree.Child(frame.Context.Node, slot);
+			if (child == NoNode) continue;
+
+			context.Node = child;
+			context.Parent = frame.Context.Node;
+			context.Slot = slot;
+			context.Depth = frame.Context.Depth + 1;
+			Push(tree, context, visitor);
+		}
+	}
+
+	bool Walker::Push(const Tree& tree, const VisitContext& context, Visitor& visitor) {
+		if (!visitor.Enter(tree, context)) return false;
+
+		m_Frames.push_back({ context, 0, static_cast<std::uint32_t>(tree.ChildCount(context.Node)) });
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include <ice/vm/Bytecode.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+	using ice::vm::GetA;
+	using ice::vm::GetB;
+	using ice::vm::GetC;
+	using ice::vm::GetOpCode;
+	using ice::vm::GetOpFormat;
+	using ice::vm::GetSBx;
+	using ice::vm::GetSC;
+	using ice::vm::OpCode;
+	using ice::vm::OpFormat;
+
+	constexpr std::string_view s_OpCodeNames[] = {
+#define E(x, y, z, w) #x
+#include <ice/detail/OpCode.txt>
+#undef E
+	};
+
+	bool IsTerminator(OpCode opCode) noexcept {
+		return opCode == OpCode::Jump || opCode == OpCode::Return;
+	}
+	std::int64_t GetJumpOffset(ice::vm::Instruction instruction) noexcept {
+		return GetOpFormat(GetOpCode(instruction)) == OpFormat::ABsC ? GetSC(instruction) : GetSBx(instruction);
+	}
+	bool HasValidRegisters(ice::vm::Instruction instruction, std::size_t registerCount) noexcept {
+		const std::size_t width = ice::vm::IsWideOpCode(GetOpCode(instruction)) ? 2 : 1;
+		const std::size_t a = GetA(instruction) + width, b = GetB(instruction) + width, c = GetC(instruction) + width;
+
+		switch (GetOpFormat(GetOpCode(instruction))) {
+		case OpFormat::A:
+		case OpFormat::ABx:
+		case OpFormat::AsBx:
+			return a <= registerCount;
+
+		case OpFormat::AB:
+		case OpFormat::ABsC:
+			return a <= registerCount && b <= registerCount;
+
+		case OpFormat::ABC:
+			return a <= registerCount && b <= registerCount && c <= registerCount;
+
+		default:
+			return true;
+		}
+	}
+	bool Fail(std::string* error, const ice::vm::Function& function, std::size_t index, std::string_view reason) {
+		if (error) {
+			*error = function.Name() + ':' + std::to_string(index) + ": " + std::string(reason);
+		}
+		return false;
+	}
+}
+
+namespace ice::vm {
+	std::string_view GetOpCodeName(OpCode opCode) noexcept {
+		return s_OpCodeNames[static_cast<std::size_t>(opCode)];
+	}
+}
+
+namespace ice::vm {
+	Function::Function(std::string name, std::uint16_t parameterCount, std::uint16_t resultCount, std::uint16_t registerCount)
+		: m_Name(std::move(name)), m_ParameterCount(parameterCount), m_ResultCount(resultCount), m_RegisterCount(registerCount) {
+	}
+	Function::Function(const Function& function)
+		: m_Name(function.m_Name), m_Instructions(function.m_Instructions), m_Constants(function.m_Constants), m_ParameterCount(function.m_ParameterCount),
+		m_ResultCount(function.m_ResultCount), m_RegisterCount(function.m_RegisterCount) {
+	}
+	Function::Function(Function&& function) noexcept
+		: m_Name(std::move(function.m_Name)), m_Instructions(std::move(function.m_Instructions)), m_Constants(std::move(function.m_Constants)),
+		m_ParameterCount(function.m_ParameterCount), m_ResultCount(function.m_ResultCount), m_RegisterCount(function.m_RegisterCount) {
+		function.m_ParameterCount = function.m_ResultCount = function.m_RegisterCount = 0;
+	}
+
+	Function& Function::operator=(const Function& function) {
+		m_Name = function.m_Name;
+		m_Instructions = function.m_Instructions;
+		m_Constants = function.m_Constants;
+		m_ParameterCount = function.m_ParameterCount;
+		m_ResultCount = function.m_ResultCount;
+		m_RegisterCount = function.m_RegisterCount;
+
+		return *this;
+	}
+	Function& Function::operator=(Function&& function) noexcept {
+		m_Name = std::move(function.m_Name);
+		m_Instructions = std::move(function.m_Instructions);
+		m_Constants = std::move(function.m_Constants);
+		m_ParameterCount = function.m_ParameterCount;
+		m_ResultCount = function.m_ResultCount;
+		m_RegisterCount = function.m_RegisterCount;
+
+		function.m_ParameterCount = function.m_ResultCount = function.m_RegisterCount = 0;
+
+		return *this;
+	}
+
+	const std::string& Function::Name() const noexcept {
+		return m_Name;
+	}
+	std::uint16_t Function::ParameterCount() const noexcept {
+		return m_ParameterCount;
+	}
+	std::uint16_t Function::ResultCount() const noexcept {
+		return m_ResultCount;
+	}
+	std::uint16_t Function::RegisterCount() const noexcept {
+		return m_RegisterCount;
+	}
+	void Function::RegisterCount(std::uint16_t newRegisterCount) noexcept {
+		m_RegisterCount = newRegisterCount;
+	}
+	const std::vector<Instruction>& Function::Instructions() const noexcept {
+		return m_Instructions;
+	}
+	const std::vector<std::uint64_t>& Function::Constants() const noexcept {
+		return m_Constants;
+	}
+	std::size_t Function::Size() const noexcept {
+		return m_Instructions.size();
+	}
+
+	std::size_t Function::Emit(Instruction instruction) {
+		m_Instructions.push_back(instruction);
+		return m_Instructions.size() - 1;
+	}
+	void Function::Patch(std::size_t index, Instruction instruction) noexcept {
+		m_Instructions[index] = instruction;
+	}
+	std::uint32_t Function::AddConstant(std::uint64_t constant) {
+		for (std::size_t i = 0; i < m_Constants.size(); ++i) {
+			if (m_Constants[i] == constant) return static_cast<std::uint32_t>(i);
+		}
+
+		m_Constants.push_back(constant);
+		return static_cast<std::uint32_t>(m_Constants.size() - 1);
+	}
+	std::uint32_t Function::AddConstant(double constant) {
+		std::uint64_t bits;
+		std::memcpy(&bits, &constant, sizeof(bits));
+		return AddConstant(bits);
+	}
+	std::uint32_t Function::AddConstant(Value constant) {
+		return AddConstant(constant.Bits());
+	}
+}
+
+namespace ice::vm {
+	Program::Program(const Program& program)
+		: m_Functions(program.m_Functions) {
+	}
+	Program::Program(Program&& program) noexcept
+		: m_Functions(std::move(program.m_Functions)) {
+	}
+
+	Program& Program::operator=(const Program& program) {
+		m_Functions = program.m_Functions;
+
+		return *this;
+	}
+	Program& Program::operator=(Program&& program) noexcept {
+		m_Functions = std::move(program.m_Functions);
+
+		return *this;
+	}
+	const Function& Program::operator[](std::size_t index) const noexcept {
+		return m_Functions[index];
+	}
+	Function& Program::operator[](std::size_t index) noexcept {
+		return m_Functions[index];
+	}
+
+	std::size_t Program::Size() const noexcept {
+		return m_Functions.size();
+	}
+	const std::vector<Function>& Program::Functions() const noexcept {
+		return m_Functions;
+	}
+	std::uint32_t Program::AddFunction(Function function) {
+		m_Functions.push_back(std::move(function));
+		return static_cast<std::uint32_t>(m_Functions.size() - 1);
+	}
+	bool Program::Verify(std::string* error) const {
+		for (const Function& function : m_Functions) {
+			const std::vector<Instruction>& instructions = function.Instructions();
+			const std::size_t registerCount = function.RegisterCount();
+			if (function.ParameterCount() > registerCount || function.ResultCount() > 2) return Fail(error, function, 0, "invalid signature");
+			if (instructions.empty() || !IsTerminator(GetOpCode(instructions.back()))) return Fail(error, function, instructions.size(), "missing terminator");
+
+			for (std::size_t i = 0; i < instructions.size(); ++i) {
+				const Instruction instruction = instructions[i];
+				const OpCode opCode = GetOpCode(instruction);
+				if (static_cast<std::size_t>(opCode) >= static_cast<std::size_t>(OpCode::Count)) return Fail(error, function, i, "invalid opcode");
+
+				const auto isRegister = [&](std::size_t index, std::size_t count) {
+					return index + count <= registerCount;
+				};
+
+				bool isValid;
+				switch (opCode) {
+				case OpCode::Convert: {
+					const NumericType from = GetConversionSource(GetC(instruction));
+					const NumericType to = GetConversionTarget(GetC(instruction));
+					isValid = from < NumericType::Count && to < NumericType::Count && isRegister(GetA(instruction), IsWideNumericType(to) ? 2 : 1) &&
+							  isRegister(GetB(instruction), IsWideNumericType(from) ? 2 : 1);
+					break;
+				}
+
+				case OpCode::BoxValue:
+				case OpCode::UnboxValue: {
+					const NumericType type = static_cast<NumericType>(GetC(instruction));
+					const std::size_t width = type < NumericType::Count && IsWideNumericType(type) ? 2 : 1;
+					isValid = type < NumericType::Count && isRegister(GetA(instruction), opCode == OpCode::BoxValue ? 1 : width) &&
+							  isRegister(GetB(instruction), opCode == OpCode::BoxValue ? width : 1);
+					break;
+				}
+
+				case OpCode::Call: {
+					if (GetB(instruction) >= m_Functions.size()) return Fail(error, function, i, "invalid function");
+
+					const Function& callee = m_Functions[GetB(instruction)];
+					isValid = GetC(instruction) == callee.ParameterCount() &&
+							  isRegister(GetA(instruction), std::max<std::size_t>(GetC(instruction), callee.ResultCount()));
+					break;
+				}
+
+				case OpCode::Return:
+					isValid = GetB(instruction) == function.ResultCount() && isRegister(GetA(instruction), GetB(instruction));
+					break;
+
+				case OpCode::LoadConstant:
+					isValid = HasValidRegisters(instruction, registerCount) && GetBx(instruction) < function.Constants().size();
+					break;
+
+				default:
+					isValid = HasValidRegisters(instruction, registerCount);
+					break;
+				}
+				if (!isValid) return Fail(error, function, i, "invalid operand");
+
+				if (IsJumpOpCode(opCode)) {
+					const std::int64_t target = static_cast<std::int64_t>(i) + 1 + GetJumpOffset(instruction);
+					if (target < 0 || target >= static_cast<std::int64_t>(instructions.size())) return Fail(error, function, i, "invalid jump target");
+				}
+			}
+		}
+		return true;
+	}
+	void Program::Disassemble(std::ostream& stream) const {
+		for (std::size_t i = 0; i < m_Functions.size(); ++i) {
+			const Function& function = m_Functions[i];
+			stream << "function " << i << ' ' << function.Name() << " (parameters " << function.ParameterCount() << ", results " << function.ResultCount()
+				   << ", registers " << function.RegisterCount() << ")\n";
+
+			for (std::size_t j = 0; j < function.Size(); ++j) {
+				const Instruction instruction = function.Instructions()[j];
+				const OpCode opCode = GetOpCode(instruction);
+				stream << '\t' << j << '\t' << GetOpCodeName(opCode);
+
+				if (opCode == OpCode::Call) {
+					stream << " r" << GetA(instruction) << ", " << m_Functions[GetB(instruction)].Name() << ", " << GetC(instruction) << '\n';
+					continue;
+				} else if (opCode == OpCode::Return) {
+					stream << " r" << GetA(instruction) << ", " << GetB(instruction) << '\n';
+					continue;
+				}
+
+				switch (GetOpFormat(opCode)) {
+				case OpFormat::None: break;
+				case OpFormat::A: stream << " r" << GetA(instruction); break;
+				case OpFormat::AB: stream << " r" << GetA(instruction) << ", r" << GetB(instruction); break;
+				case OpFormat::ABC: stream << " r" << GetA(instruction) << ", r" << GetB(instruction) << ", r" << GetC(instruction); break;
+				case OpFormat::ABx: stream << " r" << GetA(instruction) << ", " << GetBx(instruction); break;
+				case OpFormat::AsBx: stream << " r" << GetA(instruction) << ", " << GetSBx(instruction); break;
+				case OpFormat::sBx: stream << ' ' << GetSBx(instruction); break;
+				case OpFormat::ABsC: stream << " r" << GetA(instruction) << ", r" << GetB(instruction) << ", " << GetSC(instruction); break;
+				}
+				if (IsJumpOpCode(opCode)) {
+					stream << " -> " << static_cast<std::int64_t>(j) + 1 + GetJumpOffset(instruction);
+				}
+				stream << '\n';
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,631 @@
+#include <ice/vm/Interpreter.hpp>
+
+#include <ice/detail/Config.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace {
+	using ice::vm::NumericType;
+	using ice::vm::Register;
+
+#ifdef ISINT128
+	using Int128 = __int128;
+	using UInt128 = unsigned __int128;
+#endif
+
+	constexpr std::string_view s_ExecutionStatusNames[] = {
+		"Success",
+		"StackOverflow",
+		"DivisionByZero",
+		"TypeError",
+		"UnsupportedInstruction",
+	};
+
+	struct CallFrame final {
+		CallFrame* Previous;
+		const ice::vm::Function* Function;
+		const ice::vm::Instruction* ReturnAddress;
+		Register* Registers;
+		std::uint16_t ResultRegister;
+	};
+
+	template<typename T>
+	struct UnsignedOf final {
+		using Type = std::make_unsigned_t<T>;
+	};
+	template<typename T>
+	inline constexpr bool IsSigned = std::is_signed_v<T>;
+	template<typename T>
+	inline constexpr bool IsFloat = std::is_floating_point_v<T>;
+
+#ifdef ISINT128
+	template<>
+	struct UnsignedOf<Int128> final {
+		using Type = UInt128;
+	};
+	template<>
+	struct UnsignedOf<UInt128> final {
+		using Type = UInt128;
+	};
+	template<>
+	inline constexpr bool IsSigned<Int128> = true;
+#endif
+
+	template<typename T>
+	using Wrapping = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, typename UnsignedOf<T>::Type>;
+
+	template<typename T>
+	T Load(const Register* registers) noexcept {
+		if constexpr (std::is_same_v<T, float>) {
+			const std::uint32_t bits = static_cast<std::uint32_t>(*registers);
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		} else if constexpr (std::is_same_v<T, double>) {
+			double value;
+			std::memcpy(&value, registers, sizeof(value));
+			return value;
+		} else if constexpr (sizeof(T) > sizeof(Register)) {
+			using U = typename UnsignedOf<T>::Type;
+			return static_cast<T>(static_cast<U>(registers[1]) << 64 | registers[0]);
+		} else {
+			return static_cast<T>(*registers);
+		}
+	}
+	template<typename T>
+	void Store(Register* registers, T value) noexcept {
+		if constexpr (std::is_same_v<T, float>) {
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			*registers = bits;
+		} else if constexpr (std::is_same_v<T, double>) {
+			std::memcpy(registers, &value, sizeof(value));
+		} else if constexpr (sizeof(T) > sizeof(Register)) {
+			using U = typename UnsignedOf<T>::Type;
+			const U bits = static_cast<U>(value);
+			registers[0] = static_cast<Register>(bits);
+			registers[1] = static_cast<Register>(bits >> 64);
+		} else {
+			*registers = static_cast<Register>(value);
+		}
+	}
+
+	template<typename T>
+	T Add(T lhs, T rhs) noexcept {
+		if constexpr (IsFloat<T>) return lhs + rhs;
+		else return static_cast<T>(static_cast<Wrapping<T>>(static_cast<Wrapping<T>>(lhs) + static_cast<Wrapping<T>>(rhs)));
+	}
+	template<typename T>
+	T Sub(T lhs, T rhs) noexcept {
+		if constexpr (IsFloat<T>) return lhs - rhs;
+		else return static_cast<T>(static_cast<Wrapping<T>>(static_cast<Wrapping<T>>(lhs) - static_cast<Wrapping<T>>(rhs)));
+	}
+	template<typename T>
+	T Mul(T lhs, T rhs) noexcept {
+		if constexpr (IsFloat<T>) return lhs * rhs;
+		else return static_cast<T>(static_cast<Wrapping<T>>(static_cast<Wrapping<T>>(lhs) * static_cast<Wrapping<T>>(rhs)));
+	}
+	template<typename T>
+	T Neg(T value) noexcept {
+		if constexpr (IsFloat<T>) return -value;
+		else return Sub<T>(0, value);
+	}
+	template<typename T>
+	bool Div(T lhs, T rhs, T& result) noexcept {
+		if constexpr (IsFloat<T>) {
+			result = lhs / rhs;
+		} else {
+			if (rhs == 0) return false;
+
+			if constexpr (IsSigned<T>) {
+				if (rhs == static_cast<T>(-1)) {
+					result = Neg<T>(lhs);
+					return true;
+				}
+			}
+			result = static_cast<T>(lhs / rhs);
+		}
+		return true;
+	}
+	template<typename T>
+	bool Mod(T lhs, T rhs, T& result) noexcept {
+		if constexpr (IsFloat<T>) {
+			result = std::fmod(lhs, rhs);
+		} else {
+			if (rhs == 0) return false;
+
+			if constexpr (IsSigned<T>) {
+				if (rhs == static_cast<T>(-1)) {
+					result = 0;
+					return true;
+				}
+			}
+			result = static_cast<T>(lhs % rhs);
+		}
+		return true;
+	}
+	template<typename T>
+	T BitAnd(T lhs, T rhs) noexcept {
+		return static_cast<T>(lhs & rhs);
+	}
+	template<typename T>
+	T BitOr(T lhs, T rhs) noexcept {
+		return static_cast<T>(lhs | rhs);
+	}
+	template<typename T>
+	T BitXor(T lhs, T rhs) noexcept {
+		return static_cast<T>(lhs ^ rhs);
+	}
+	template<typename T>
+	T ShiftLeft(T lhs, T rhs) noexcept {
+		const unsigned count = static_cast<unsigned>(rhs) & (sizeof(T) * 8 - 1);
+		return static_cast<T>(static_cast<Wrapping<T>>(lhs) << count);
+	}
+	template<typename T>
+	T ShiftRight(T lhs, T rhs) noexcept {
+		const unsigned count = static_cast<unsigned>(rhs) & (sizeof(T) * 8 - 1);
+		return static_cast<T>(lhs >> count);
+	}
+
+	template<typename To, typename From>
+	To Cast(From value) noexcept {
+		if constexpr (IsFloat<From> && !IsFloat<To>) {
+			using U = typename UnsignedOf<To>::Type;
+			constexpr To max = static_cast<To>(IsSigned<To> ? static_cast<U>(~U(0)) >> 1 : static_cast<U>(~U(0)));
+			constexpr To min = static_cast<To>(IsSigned<To> ? ~static_cast<U>(max) : 0);
+
+			if (std::isnan(value)) return 0;
+			else if (value < static_cast<From>(min)) return min;
+			else if (value >= static_cast<From>(max)) return max;
+			else return static_cast<To>(value);
+		} else {
+			return static_cast<To>(value);
+		}
+	}
+	template<typename From>
+	bool ConvertFrom(Register* target, const Register* source, NumericType to) noexcept {
+		const From value = Load<From>(source);
+		switch (to) {
+		case NumericType::Int8: Store<std::int8_t>(target, Cast<std::int8_t>(value)); return true;
+		case NumericType::Int16: Store<std::int16_t>(target, Cast<std::int16_t>(value)); return true;
+		case NumericType::Int32: Store<std::int32_t>(target, Cast<std::int32_t>(value)); return true;
+		case NumericType::Int64: Store<std::int64_t>(target, Cast<std::int64_t>(value)); return true;
+		case NumericType::UInt8: Store<std::uint8_t>(target, Cast<std::uint8_t>(value)); return true;
+		case NumericType::UInt16: Store<std::uint16_t>(target, Cast<std::uint16_t>(value)); return true;
+		case NumericType::UInt32: Store<std::uint32_t>(target, Cast<std::uint32_t>(value)); return true;
+		case NumericType::UInt64: Store<std::uint64_t>(target, Cast<std::uint64_t>(value)); return true;
+		case NumericType::Float32: Store<float>(target, Cast<float>(value)); return true;
+		case NumericType::Float64: Store<double>(target, Cast<double>(value)); return true;
+#ifdef ISINT128
+		case NumericType::Int128: Store<Int128>(target, Cast<Int128>(value)); return true;
+		case NumericType::UInt128: Store<UInt128>(target, Cast<UInt128>(value)); return true;
+#endif
+		default: return false;
+		}
+	}
+	template<typename From>
+	ice::vm::Value BoxFrom(const Register* source) noexcept {
+		const From value = Load<From>(source);
+		if constexpr (IsFloat<From>) {
+			return ice::vm::Value::FromDouble(value);
+		} else {
+			constexpr From max = static_cast<From>(std::numeric_limits<std::int32_t>::max());
+			const bool isInt = IsSigned<From> ? value >= static_cast<From>(std::numeric_limits<std::int32_t>::min()) && value <= max : value <= max;
+			return isInt ? ice::vm::Value::FromInt(static_cast<std::int32_t>(value)) : ice::vm::Value::FromDouble(static_cast<double>(value));
+		}
+	}
+	bool Box(Register* target, const Register* source, NumericType from) noexcept {
+		switch (from) {
+		case NumericType::Int8: *target = BoxFrom<std::int8_t>(source).Bits(); return true;
+		case NumericType::Int16: *target = BoxFrom<std::int16_t>(source).Bits(); return true;
+		case NumericType::Int32: *target = BoxFrom<std::int32_t>(source).Bits(); return true;
+		case NumericType::Int64: *target = BoxFrom<std::int64_t>(source).Bits(); return true;
+		case NumericType::UInt8: *target = BoxFrom<std::uint8_t>(source).Bits(); return true;
+		case NumericType::UInt16: *target = BoxFrom<std::uint16_t>(source).Bits(); return true;
+		case NumericType::UInt32: *target = BoxFrom<std::uint32_t>(source).Bits(); return true;
+		case NumericType::UInt64: *target = BoxFrom<std::uint64_t>(source).Bits(); return true;
+		case NumericType::Float32: *target = BoxFrom<float>(source).Bits(); return true;
+		case NumericType::Float64: *target = BoxFrom<double>(source).Bits(); return true;
+#ifdef ISINT128
+		case NumericType::Int128: *target = BoxFrom<Int128>(source).Bits(); return true;
+		case NumericType::UInt128: *target = BoxFrom<UInt128>(source).Bits(); return true;
+#endif
+		default: return false;
+		}
+	}
+	bool Convert(Register* target, const Register* source, std::uint16_t conversion) noexcept {
+		const NumericType to = ice::vm::GetConversionTarget(conversion);
+		switch (ice::vm::GetConversionSource(conversion)) {
+		case NumericType::Int8: return ConvertFrom<std::int8_t>(target, source, to);
+		case NumericType::Int16: return ConvertFrom<std::int16_t>(target, source, to);
+		case NumericType::Int32: return ConvertFrom<std::int32_t>(target, source, to);
+		case NumericType::Int64: return ConvertFrom<std::int64_t>(target, source, to);
+		case NumericType::UInt8: return ConvertFrom<std::uint8_t>(target, source, to);
+		case NumericType::UInt16: return ConvertFrom<std::uint16_t>(target, source, to);
+		case NumericType::UInt32: return ConvertFrom<std::uint32_t>(target, source, to);
+		case NumericType::UInt64: return ConvertFrom<std::uint64_t>(target, source, to);
+		case NumericType::Float32: return ConvertFrom<float>(target, source, to);
+		case NumericType::Float64: return ConvertFrom<double>(target, source, to);
+#ifdef ISINT128
+		case NumericType::Int128: return ConvertFrom<Int128>(target, source, to);
+		case NumericType::UInt128: return ConvertFrom<UInt128>(target, source, to);
+#endif
+		default: return false;
+		}
+	}
+}
+
+namespace ice::vm {
+	std::string_view GetExecutionStatusName(ExecutionStatus status) noexcept {
+		return s_ExecutionStatusNames[static_cast<std::size_t>(status)];
+	}
+}
+
+#define R(x) (registers + (x))
+
+#ifdef ISCOMPUTEDGOTO
+#	define CASE(x) Label##x:
+#	define DISPATCH() goto* s_Labels[static_cast<std::size_t>(GetOpCode(instruction = *pc++))]
+#	define NEXT() DISPATCH()
+#else
+#	define CASE(x) case OpCode::x:
+#	define DISPATCH()
+#	define NEXT() continue
+#endif
+
+#define BINARY(x, name, type) \
+	CASE(x##name) \
+	Store<type>(R(GetA(instruction)), ::x<type>(Load<type>(R(GetB(instruction))), Load<type>(R(GetC(instruction))))); \
+	NEXT();
+#define CHECKED(x, name, type) \
+	CASE(x##name) { \
+		type result; \
+		if (!::x<type>(Load<type>(R(GetB(instruction))), Load<type>(R(GetC(instruction))), result)) goto OnDivisionByZero; \
+		Store<type>(R(GetA(instruction)), result); \
+	} \
+	NEXT();
+#define COMPARE(x, name, type, op) \
+	CASE(x##name) \
+	Store<Register>(R(GetA(instruction)), Load<type>(R(GetB(instruction))) op Load<type>(R(GetC(instruction)))); \
+	NEXT();
+#define BRANCH(x, name, type, op) \
+	CASE(x##name) \
+	if (Load<type>(R(GetA(instruction))) op Load<type>(R(GetB(instruction)))) { \
+		pc += GetSC(instruction); \
+	} \
+	NEXT();
+
+#define NUMERIC(name, type) \
+	BINARY(Add, name, type) \
+	BINARY(Sub, name, type) \
+	BINARY(Mul, name, type) \
+	CHECKED(Div, name, type) \
+	CHECKED(Mod, name, type) \
+	CASE(Neg##name) \
+	Store<type>(R(GetA(instruction)), ::Neg<type>(Load<type>(R(GetB(instruction))))); \
+	NEXT(); \
+	COMPARE(Equal, name, type, ==) \
+	COMPARE(NotEqual, name, type, !=) \
+	COMPARE(Less, name, type, <) \
+	COMPARE(LessEqual, name, type, <=) \
+	BRANCH(JumpIfEqual, name, type, ==) \
+	BRANCH(JumpIfNotEqual, name, type, !=) \
+	BRANCH(JumpIfLess, name, type, <) \
+	BRANCH(JumpIfLessEqual, name, type, <=)
+#define INTEGER(name, type) \
+	NUMERIC(name, type) \
+	CASE(AddImmediate##name) \
+	Store<type>(R(GetA(instruction)), ::Add<type>(Load<type>(R(GetB(instruction))), static_cast<type>(GetSC(instruction)))); \
+	NEXT(); \
+	CASE(Loop##name) { \
+		const type counter = ::Add<type>(Load<type>(R(GetA(instruction))), 1); \
+		Store<type>(R(GetA(instruction)), counter); \
+		if (counter < Load<type>(R(GetB(instruction)))) { \
+			pc += GetSC(instruction); \
+		} \
+	} \
+	NEXT(); \
+	BINARY(BitAnd, name, type) \
+	BINARY(BitOr, name, type) \
+	BINARY(BitXor, name, type) \
+	BINARY(ShiftLeft, name, type) \
+	BINARY(ShiftRight, name, type) \
+	CASE(BitNot##name) \
+	Store<type>(R(GetA(instruction)), static_cast<type>(~Load<type>(R(GetB(instruction))))); \
+	NEXT();
+#define VALUE_BINARY(x) \
+	CASE(x##Value) { \
+		Value result; \
+		if (!x(Value::FromBits(*R(GetB(instruction))), Value::FromBits(*R(GetC(instruction))), result)) goto OnTypeError; \
+		*R(GetA(instruction)) = result.Bits(); \
+	} \
+	NEXT();
+#define VALUE_COMPARE(x) \
+	CASE(x##Value) { \
+		bool result; \
+		if (!x(Value::FromBits(*R(GetB(instruction))), Value::FromBits(*R(GetC(instruction))), result)) goto OnTypeError; \
+		*R(GetA(instruction)) = Value::FromBool(result).Bits(); \
+	} \
+	NEXT();
+#define VALUE_BRANCH(x) \
+	CASE(JumpIf##x##Value) { \
+		bool result; \
+		if (!x(Value::FromBits(*R(GetA(instruction))), Value::FromBits(*R(GetB(instruction))), result)) goto OnTypeError; \
+		if (result) { \
+			pc += GetSC(instruction); \
+		} \
+	} \
+	NEXT();
+#define UNSUPPORTED(name) \
+	CASE(Add##name) CASE(Sub##name) CASE(Mul##name) CASE(Div##name) CASE(Mod##name) CASE(Neg##name) \
+	CASE(Equal##name) CASE(NotEqual##name) CASE(Less##name) CASE(LessEqual##name) \
+	CASE(JumpIfEqual##name) CASE(JumpIfNotEqual##name) CASE(JumpIfLess##name) CASE(JumpIfLessEqual##name) \
+	CASE(AddImmediate##name) CASE(Loop##name) CASE(BitAnd##name) CASE(BitOr##name) CASE(BitXor##name) \
+	CASE(ShiftLeft##name) CASE(ShiftRight##name) CASE(BitNot##name) \
+	goto OnUnsupportedInstruction;
+
+namespace ice::vm {
+	Interpreter::Interpreter(std::size_t stackSize) noexcept
+		: m_Stack(stackSize) {
+	}
+	Interpreter::Interpreter(Interpreter&& interpreter) noexcept
+		: m_Stack(std::move(interpreter.m_Stack)) {
+	}
+
+	Interpreter& Interpreter::operator=(Interpreter&& interpreter) noexcept {
+		m_Stack = std::move(interpreter.m_Stack);
+
+		return *this;
+	}
+
+	const ice::Stack& Interpreter::ExecutionStack() const noexcept {
+		return m_Stack;
+	}
+	ExecutionStatus Interpreter::Run(const Program& program, std::uint32_t function, Span<const Register> arguments, Span<Register> results) {
+#ifdef ISCOMPUTEDGOTO
+		static const void* const s_Labels[] = {
+#	define E(x, y, z, w) &&Label##x
+#	include <ice/detail/OpCode.txt>
+#	undef E
+		};
+#endif
+
+		const Function* const functions = program.Functions().data();
+		std::uint8_t* const stackTop = m_Stack.Top();
+		ExecutionStatus status = ExecutionStatus::Success;
+
+		const Function* current = functions + function;
+		CallFrame* frame = m_Stack.Push(CallFrame{ nullptr, nullptr, nullptr, nullptr, 0 });
+		Register* registers = frame ? m_Stack.AllocateFrame<Register>(current->RegisterCount()) : nullptr;
+		const Instruction* pc = current->Instructions().data();
+		const std::uint64_t* constants = current->Constants().data();
+		Instruction instruction = 0;
+
+		if (!registers) goto OnStackOverflow;
+
+		for (std::size_t i = 0; i < current->RegisterCount(); ++i) {
+			registers[i] = i < arguments.Size() ? arguments[i] : 0;
+		}
+
+#ifdef ISCOMPUTEDGOTO
+		DISPATCH();
+#else
+		for (;;) {
+			instruction = *pc++;
+			switch (GetOpCode(instruction)) {
+#endif
+
+		CASE(Nop)
+		NEXT();
+
+		CASE(Move)
+		*R(GetA(instruction)) = *R(GetB(instruction));
+		NEXT();
+
+		CASE(LoadConstant)
+		*R(GetA(instruction)) = constants[GetBx(instruction)];
+		NEXT();
+
+		CASE(LoadImmediate)
+		*R(GetA(instruction)) = static_cast<Register>(static_cast<std::int64_t>(GetSBx(instruction)));
+		NEXT();
+
+		CASE(Not)
+		*R(GetA(instruction)) = *R(GetB(instruction)) == 0;
+		NEXT();
+
+		CASE(Jump)
+		pc += GetSBx(instruction);
+		NEXT();
+
+		CASE(JumpIfTrue)
+		if (*R(GetA(instruction)) != 0) {
+			pc += GetSBx(instruction);
+		}
+		NEXT();
+
+		CASE(JumpIfFalse)
+		if (*R(GetA(instruction)) == 0) {
+			pc += GetSBx(instruction);
+		}
+		NEXT();
+
+		CASE(Convert)
+		if (!Convert(R(GetA(instruction)), R(GetB(instruction)), GetC(instruction))) goto OnUnsupportedInstruction;
+		NEXT();
+
+		CASE(Call) {
+			const Function& callee = functions[GetB(instruction)];
+			const std::uint16_t argumentCount = GetC(instruction);
+			CallFrame* const calleeFrame = m_Stack.Push(CallFrame{ frame, current, pc, registers, GetA(instruction) });
+			Register* const calleeRegisters = calleeFrame ? m_Stack.AllocateFrame<Register>(callee.RegisterCount()) : nullptr;
+			if (!calleeRegisters) goto OnStackOverflow;
+
+			for (std::uint16_t i = 0; i < argumentCount; ++i) {
+				calleeRegisters[i] = registers[GetA(instruction) + i];
+			}
+			for (std::uint16_t i = argumentCount; i < callee.RegisterCount(); ++i) {
+				calleeRegisters[i] = 0;
+			}
+
+			frame = calleeFrame;
+			registers = calleeRegisters;
+			current = &callee;
+			pc = callee.Instructions().data();
+			constants = callee.Constants().data();
+		}
+		NEXT();
+
+		CASE(Return) {
+			const Register* const values = R(GetA(instruction));
+			const std::uint16_t valueCount = GetB(instruction);
+			if (!frame->Function) {
+				for (std::size_t i = 0; i < valueCount && i < results.Size(); ++i) {
+					results[i] = values[i];
+				}
+				goto OnExit;
+			}
+
+			for (std::uint16_t i = 0; i < valueCount; ++i) {
+				frame->Registers[frame->ResultRegister + i] = values[i];
+			}
+
+			CallFrame* const previous = frame->Previous;
+			current = frame->Function;
+			pc = frame->ReturnAddress;
+			registers = frame->Registers;
+			constants = current->Constants().data();
+			m_Stack.Free(frame);
+			frame = previous;
+		}
+		NEXT();
+
+		CASE(BoxValue)
+		if (!Box(R(GetA(instruction)), R(GetB(instruction)), static_cast<NumericType>(GetC(instruction)))) goto OnUnsupportedInstruction;
+		NEXT();
+
+		CASE(UnboxValue) {
+			const Value value = Value::FromBits(*R(GetB(instruction)));
+			const NumericType to = static_cast<NumericType>(GetC(instruction));
+			if (!value.IsNumber()) goto OnTypeError;
+			else if (!(value.IsInt() ? ConvertFrom<std::int32_t>(R(GetA(instruction)), R(GetB(instruction)), to)
+									 : ConvertFrom<double>(R(GetA(instruction)), R(GetB(instruction)), to))) goto OnUnsupportedInstruction;
+		}
+		NEXT();
+
+		VALUE_BINARY(Add)
+		VALUE_BINARY(Sub)
+		VALUE_BINARY(Mul)
+		VALUE_BINARY(Div)
+		VALUE_BINARY(Mod)
+
+		CASE(NegValue) {
+			Value result;
+			if (!Neg(Value::FromBits(*R(GetB(instruction))), result)) goto OnTypeError;
+			*R(GetA(instruction)) = result.Bits();
+		}
+		NEXT();
+
+		CASE(EqualValue)
+		*R(GetA(instruction)) = Value::FromBool(Equal(Value::FromBits(*R(GetB(instruction))), Value::FromBits(*R(GetC(instruction))))).Bits();
+		NEXT();
+
+		CASE(NotEqualValue)
+		*R(GetA(instruction)) = Value::FromBool(!Equal(Value::FromBits(*R(GetB(instruction))), Value::FromBits(*R(GetC(instruction))))).Bits();
+		NEXT();
+
+		VALUE_COMPARE(Less)
+		VALUE_COMPARE(LessEqual)
+
+		CASE(JumpIfEqualValue)
+		if (Equal(Value::FromBits(*R(GetA(instruction))), Value::FromBits(*R(GetB(instruction))))) {
+			pc += GetSC(instruction);
+		}
+		NEXT();
+
+		CASE(JumpIfNotEqualValue)
+		if (!Equal(Value::FromBits(*R(GetA(instruction))), Value::FromBits(*R(GetB(instruction))))) {
+			pc += GetSC(instruction);
+		}
+		NEXT();
+
+		VALUE_BRANCH(Less)
+		VALUE_BRANCH(LessEqual)
+
+		CASE(JumpIfTruthyValue)
+		if (Value::FromBits(*R(GetA(instruction))).IsTruthy()) {
+			pc += GetSBx(instruction);
+		}
+		NEXT();
+
+		CASE(JumpIfFalsyValue)
+		if (Value::FromBits(*R(GetA(instruction))).IsFalsy()) {
+			pc += GetSBx(instruction);
+		}
+		NEXT();
+
+		INTEGER(I8, std::int8_t)
+		INTEGER(I16, std::int16_t)
+		INTEGER(I32, std::int32_t)
+		INTEGER(I64, std::int64_t)
+		INTEGER(U8, std::uint8_t)
+		INTEGER(U16, std::uint16_t)
+		INTEGER(U32, std::uint32_t)
+		INTEGER(U64, std::uint64_t)
+#ifdef ISINT128
+		INTEGER(I128, Int128)
+		INTEGER(U128, UInt128)
+#else
+		UNSUPPORTED(I128)
+		UNSUPPORTED(U128)
+#endif
+		NUMERIC(F32, float)
+		NUMERIC(F64, double)
+
+#ifndef ISCOMPUTEDGOTO
+			default:
+				goto OnUnsupportedInstruction;
+			}
+		}
+#endif
+
+	OnStackOverflow:
+		status = ExecutionStatus::StackOverflow;
+		goto OnExit;
+
+	OnDivisionByZero:
+		status = ExecutionStatus::DivisionByZero;
+		goto OnExit;
+
+	OnTypeError:
+		status = ExecutionStatus::TypeError;
+		goto OnExit;
+
+	OnUnsupportedInstruction:
+		status = ExecutionStatus::UnsupportedInstruction;
+		goto OnExit;
+
+	OnExit:
+		m_Stack.Free(stackTop);
+		return status;
+	}
+}
+
+#undef R
+#undef CASE
+#undef DISPATCH
+#undef NEXT
+#undef BINARY
+#undef CHECKED
+#undef COMPARE
+#undef BRANCH
+#undef NUMERIC
+#undef INTEGER
+#undef VALUE_BINARY
+#undef VALUE_COMPARE
+#undef VALUE_BRANCH
+#undef UNSUPPORTED
\ No newline at end of file
@@ -0,0 +1,17 @@
+#include <ice/vm/Value.hpp>
+
+namespace {
+	constexpr std::string_view s_ValueTypeNames[] = {
+		"null",
+		"bool",
+		"int",
+		"double",
+		"object",
+	};
+}
+
+namespace ice::vm {
+	std::string_view GetValueTypeName(ValueType type) noexcept {
+		return s_ValueTypeNames[static_cast<std::size_t>(type)];
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "Test.hpp"
+
+#include <ice/Cache.hpp>
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+#include <ice/Parser.hpp>
+#include <ice/ast/Dumper.hpp>
+#include <ice/ast/Tree.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace {
+	constexpr std::string_view s_Source =
+		"var x: int32 = 1 + 2 * 3 ** 2 ** 2\n"
+		"let y = -x.value[3](a, b,\n"
+		"    c) ? \"s\" : 'c'\n"
+		"function add(a: int32, b: int32 = 0) -> int32 {\n"
+		"    return a + b\n"
+		"}\n"
+		"if x < 3 && y { x += 1 } else if x { } else {\n"
+		"    z = (a, b) => a * b\n"
+		"}\n"
+		"while i < 10 { i++ }\n"
+		"do { i-- } while i > 0\n"
+		"for var i = 0; i < n; ++i { print(i as float64) }\n"
+		"var arr = new Foo[](1, 2)\n"
+		"var \xEB\xB3\x80\xEC\x88\x98 = \"\xE5\xA4\x89\xE6\x95\xB0\"\n";
+
+	std::string Dump(const ice::Interner& interner, const ice::TokenBuffer& tokens, const ice::ast::Tree& tree) {
+		std::ostringstream stream;
+		{
+			ice::ast::TextDumper dumper(stream, interner);
+			dumper.Tokens(&tokens);
+			dumper.Dump(tree);
+		}
+		return stream.str();
+	}
+}
+
+int main() {
+	const std::string directory = "CacheTest.cache";
+	const ice::CompilationCache cache(directory);
+	std::error_code error;
+	std::filesystem::remove_all(directory, error);
+
+	ice::Interner interner;
+	ice::Messages messages;
+	ice::Lexer lexer(interner);
+	ice::Parser parser(interner);
+	ice::ast::Tree tree;
+	bool isSucceeded = ice::test::Expect(lexer.Lex("input.ice", s_Source, messages), "the input lexes");
+	const ice::TokenBuffer tokens = lexer.Tokens();
+	isSucceeded &= ice::test::Expect(parser.Parse("input.ice", tokens, tree, messages), "the input parses");
+	isSucceeded &= ice::test::Expect(cache.Store("input.ice", s_Source, interner, tokens, tree), "Store writes the cache file");
+
+	const std::string expected = Dump(interner, tokens, tree);
+	for (const std::string_view prelude : { std::string_view(), std::string_view("zeta alpha value print") }) {
+		ice::Interner loadedInterner;
+		for (std::size_t begin = 0, end; begin < prelude.size(); begin = end + 1) {
+			end = std::min(prelude.find(' ', begin), prelude.size());
+			loadedInterner.Intern(prelude.substr(begin, end - begin));
+		}
+
+		ice::TokenBuffer loadedTokens;
+		ice::ast::Tree loadedTree;
+		isSucceeded &= ice::test::Expect(cache.Load("input.ice", s_Source, loadedInterner, loadedTokens, loadedTree), "Load reads the cache file");
+		isSucceeded &= ice::test::Expect(ice::test::IsEqual(tokens, interner, loadedTokens, loadedInterner), "the loaded tokens match the stored tokens");
+		isSucceeded &= ice::test::Expect(Dump(loadedInterner, loadedTokens, loadedTree) == expected, "the loaded AST matches the stored AST");
+	}
+
+	std::string modified(s_Source);
+	modified[modified.size() - 2] = 'X';
+	ice::Interner loadedInterner;
+	ice::TokenBuffer loadedTokens;
+	ice::ast::Tree loadedTree;
+	isSucceeded &= ice::test::Expect(!cache.Load("input.ice", modified, loadedInterner, loadedTokens, loadedTree), "Load rejects a modified source");
+
+	std::filesystem::remove_all(directory, error);
+	return isSucceeded ? 0 : 1;
+}
\ No newline at end of file
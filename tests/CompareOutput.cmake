@@ -0,0 +1,7 @@
+separate_arguments(OPTIONS)
+execute_process(COMMAND ${PROGRAM} ${OPTIONS} ${INPUT} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+file(READ "${EXPECTED}" expected)
+
+if(NOT output STREQUAL expected)
+	message(FATAL_ERROR "output of '${OPTIONS} ${INPUT}' does not match '${EXPECTED}':\n${output}")
+endif()
\ No newline at end of file
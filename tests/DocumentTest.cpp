@@ -0,0 +1,66 @@
+#include "Test.hpp"
+
+#include <ice/Document.hpp>
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+	bool IsEqual(const ice::Document& document, const std::string& source, const ice::Interner& interner) {
+		ice::Interner expectedInterner;
+		ice::Messages expectedMessages;
+		ice::Lexer lexer(expectedInterner);
+		lexer.Lex(document.SourceName(), source, expectedMessages);
+		const ice::TokenBuffer expectedTokens = lexer.Tokens();
+
+		const std::string text = document.Text();
+		return text == source && document.LineCount() == expectedTokens.LineCount() &&
+			   ice::test::IsEqual(document.Tokens(text), interner, expectedTokens, expectedInterner) &&
+			   ice::test::ToString(document.Diagnostics()) == ice::test::ToString(expectedMessages) && document.HasErrors() == expectedMessages.HasErrors();
+	}
+}
+
+int main() {
+	constexpr std::string_view insertions[] = {
+		"", "\n", "x", "\n\n", "\"open", "0b2", "\xEB\xB3\x80", "\xFF", "// comment\n", "var y = 1\nfunc f() {\n}\n",
+	};
+
+	std::string source = ice::test::GenerateSource(64 * 1024);
+	ice::Interner interner;
+	ice::Document document("input", interner);
+	document.Assign(source);
+	bool isSucceeded = ice::test::Expect(IsEqual(document, source, interner), "Assign matches Lex");
+	isSucceeded &= ice::test::Expect(document.BlockCount() > 1, "Assign splits the source into blocks");
+
+	std::mt19937 random(42);
+	for (std::size_t i = 0; i < 300 && isSucceeded; ++i) {
+		const std::size_t begin = std::uniform_int_distribution<std::size_t>(0, source.size())(random);
+		const std::size_t maxLength = i % 50 == 0 ? 3 * ice::Document::BlockSize : 16;
+		const std::size_t end = std::min(source.size(), begin + std::uniform_int_distribution<std::size_t>(0, maxLength)(random));
+		std::string replacement(insertions[i % std::size(insertions)]);
+		if (i % 37 == 0) {
+			replacement = ice::test::GenerateSource(2 * ice::Document::BlockSize);
+		}
+
+		document.Replace(begin, end, replacement);
+		source.replace(begin, end - begin, replacement);
+		isSucceeded &= ice::test::Expect(IsEqual(document, source, interner), "Replace matches Lex after edit " + std::to_string(i));
+	}
+
+	document.Replace(0, source.size(), "");
+	source.clear();
+	isSucceeded &= ice::test::Expect(IsEqual(document, source, interner), "Replace matches Lex after deleting everything");
+	document.Replace(0, 0, "a\n\"b");
+	source = "a\n\"b";
+	isSucceeded &= ice::test::Expect(IsEqual(document, source, interner), "Replace matches Lex after inserting into an empty document");
+	isSucceeded &= ice::test::Expect(!document.Replace(0, 100, ""), "Replace rejects a range past the end");
+
+	return isSucceeded ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "Test.hpp"
+
+#include <ice/Memory.hpp>
+#include <ice/vm/Bytecode.hpp>
+#include <ice/vm/Interpreter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	using ice::vm::ExecutionStatus;
+	using ice::vm::Function;
+	using ice::vm::MakeConversion;
+	using ice::vm::MakeInstruction;
+	using ice::vm::MakeInstructionBx;
+	using ice::vm::MakeInstructionSBx;
+	using ice::vm::MakeInstructionSC;
+	using ice::vm::NumericType;
+	using ice::vm::OpCode;
+	using ice::vm::Program;
+	using ice::vm::Register;
+
+	struct Case final {
+		std::string Name;
+		ice::vm::Program Program;
+		Register Argument = 0;
+		ExecutionStatus Status = ExecutionStatus::Success;
+		Register Result = 0;
+	};
+
+	template<typename T>
+	constexpr Register ToRegister(T value) noexcept {
+		return static_cast<Register>(value);
+	}
+
+	Program BuildBinary(OpCode opCode, std::uint64_t lhs, std::uint64_t rhs) {
+		Function function("binary", 1, 1, 3);
+		function.Emit(MakeInstructionBx(OpCode::LoadConstant, 1, function.AddConstant(lhs)));
+		function.Emit(MakeInstructionBx(OpCode::LoadConstant, 2, function.AddConstant(rhs)));
+		function.Emit(MakeInstruction(opCode, 0, 1, 2));
+		function.Emit(MakeInstruction(OpCode::Return, 0, 1));
+
+		Program program;
+		program.AddFunction(std::move(function));
+		return program;
+	}
+	Program BuildConvert(double value, NumericType to) {
+		Function function("convert", 1, 1, 2);
+		function.Emit(MakeInstructionBx(OpCode::LoadConstant, 1, function.AddConstant(value)));
+		function.Emit(MakeInstruction(OpCode::Convert, 0, 1, MakeConversion(NumericType::Float64, to)));
+		function.Emit(MakeInstruction(OpCode::Return, 0, 1));
+
+		Program program;
+		program.AddFunction(std::move(function));
+		return program;
+	}
+	Program BuildSum() {
+		Function sum("sum", 1, 1, 3);
+		sum.Emit(MakeInstructionSC(OpCode::JumpIfLessEqualI64, 0, 2, 2));
+		sum.Emit(MakeInstruction(OpCode::AddI64, 1, 1, 2));
+		sum.Emit(MakeInstructionSC(OpCode::LoopI64, 2, 0, -2));
+		sum.Emit(MakeInstruction(OpCode::Return, 1, 1));
+
+		Program program;
+		program.AddFunction(std::move(sum));
+		return program;
+	}
+	Program BuildFibonacci() {
+		Function fibonacci("fibonacci", 1, 1, 4);
+		fibonacci.Emit(MakeInstructionSBx(OpCode::LoadImmediate, 1, 2));
+		fibonacci.Emit(MakeInstructionSC(OpCode::JumpIfLessI64, 0, 1, 6));
+		fibonacci.Emit(MakeInstructionSC(OpCode::AddImmediateI64, 2, 0, -1));
+		fibonacci.Emit(MakeInstruction(OpCode::Call, 2, 0, 1));
+		fibonacci.Emit(MakeInstructionSC(OpCode::AddImmediateI64, 3, 0, -2));
+		fibonacci.Emit(MakeInstruction(OpCode::Call, 3, 0, 1));
+		fibonacci.Emit(MakeInstruction(OpCode::AddI64, 0, 2, 3));
+		fibonacci.Emit(MakeInstruction(OpCode::Return, 0, 1));
+		fibonacci.Emit(MakeInstruction(OpCode::Return, 0, 1));
+
+		Program program;
+		program.AddFunction(std::move(fibonacci));
+		return program;
+	}
+
+	std::vector<Case> CreateCases() {
+		constexpr std::int32_t int32Max = std::numeric_limits<std::int32_t>::max();
+		constexpr std::int32_t int32Min = std::numeric_limits<std::int32_t>::min();
+		constexpr std::int64_t int64Min = std::numeric_limits<std::int64_t>::min();
+
+		std::vector<Case> cases;
+		cases.push_back({ "AddI32 wraps", BuildBinary(OpCode::AddI32, ToRegister(int32Max), 1), 0, ExecutionStatus::Success, ToRegister(int32Min) });
+		cases.push_back({ "SubU32 wraps", BuildBinary(OpCode::SubU32, 0, 1), 0, ExecutionStatus::Success, 0xFFFFFFFF });
+		cases.push_back({ "MulU8 wraps", BuildBinary(OpCode::MulU8, 200, 2), 0, ExecutionStatus::Success, 144 });
+		cases.push_back({ "MulI64 wraps", BuildBinary(OpCode::MulI64, ToRegister(int64Min), ToRegister(-1)), 0, ExecutionStatus::Success,
+						  ToRegister(int64Min) });
+		cases.push_back({ "DivI32 of the minimum by -1 wraps", BuildBinary(OpCode::DivI32, ToRegister(int32Min), ToRegister(-1)), 0,
+						  ExecutionStatus::Success, ToRegister(int32Min) });
+		cases.push_back({ "ModI64 of the minimum by -1 is zero", BuildBinary(OpCode::ModI64, ToRegister(int64Min), ToRegister(-1)), 0,
+						  ExecutionStatus::Success, 0 });
+		cases.push_back({ "DivI64 by zero fails", BuildBinary(OpCode::DivI64, 1, 0), 0, ExecutionStatus::DivisionByZero, 0 });
+		cases.push_back({ "ModU32 by zero fails", BuildBinary(OpCode::ModU32, 1, 0), 0, ExecutionStatus::DivisionByZero, 0 });
+		cases.push_back({ "ShiftLeftI32 masks the count", BuildBinary(OpCode::ShiftLeftI32, 1, 33), 0, ExecutionStatus::Success, 2 });
+		cases.push_back({ "Convert saturates to the maximum", BuildConvert(1e300, NumericType::Int32), 0, ExecutionStatus::Success, ToRegister(int32Max) });
+		cases.push_back({ "Convert saturates to the minimum", BuildConvert(-1e300, NumericType::Int32), 0, ExecutionStatus::Success, ToRegister(int32Min) });
+		cases.push_back({ "Convert saturates negative values to unsigned zero", BuildConvert(-5.0, NumericType::UInt32), 0, ExecutionStatus::Success, 0 });
+		cases.push_back({ "Convert maps NaN to zero", BuildConvert(std::numeric_limits<double>::quiet_NaN(), NumericType::Int64), 0, ExecutionStatus::Success, 0 });
+		cases.push_back({ "Convert truncates toward zero", BuildConvert(-2.75, NumericType::Int8), 0, ExecutionStatus::Success, ToRegister(-2) });
+		cases.push_back({ "Loops sum", BuildSum(), 100, ExecutionStatus::Success, 4950 });
+		cases.push_back({ "Calls recurse", BuildFibonacci(), 20, ExecutionStatus::Success, 6765 });
+		return cases;
+	}
+}
+
+int main() {
+	ice::vm::Interpreter interpreter;
+	bool isSucceeded = true;
+
+	for (const Case& testCase : CreateCases()) {
+		Register result = 0;
+		const ExecutionStatus status = interpreter.Run(testCase.Program, 0, ice::Span<const Register>(&testCase.Argument, 1), ice::Span<Register>(&result, 1));
+
+		isSucceeded &= ice::test::Expect(status == testCase.Status, testCase.Name + " (status)");
+		if (status == ExecutionStatus::Success) {
+			isSucceeded &= ice::test::Expect(result == testCase.Result, testCase.Name);
+		}
+	}
+
+	return isSucceeded ? 0 : 1;
+}
\ No newline at end of file
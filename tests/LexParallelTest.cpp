@@ -0,0 +1,36 @@
+#include "Test.hpp"
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+#include <ice/ThreadPool.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+
+int main() {
+	const std::string source = ice::test::GenerateSource(2 * 1024 * 1024);
+	ice::ThreadPool pool(4);
+	bool isSucceeded = true;
+
+	for (const std::size_t size : { source.size(), source.size() / 2 + 1, std::size_t(600 * 1024) }) {
+		const std::string_view input = std::string_view(source).substr(0, size);
+
+		ice::Interner interner, parallelInterner;
+		ice::Messages messages, parallelMessages;
+		ice::Lexer lexer(interner), parallelLexer(parallelInterner);
+		const bool result = lexer.Lex("input", input, messages);
+		const bool parallelResult = parallelLexer.LexParallel("input", input, parallelMessages, pool);
+		const ice::TokenBuffer tokens = lexer.Tokens();
+		const ice::TokenBuffer parallelTokens = parallelLexer.Tokens();
+
+		isSucceeded &= ice::test::Expect(result == parallelResult, "LexParallel returns the same result as Lex");
+		isSucceeded &= ice::test::Expect(ice::test::IsEqual(tokens, interner, parallelTokens, parallelInterner), "LexParallel produces the same tokens as Lex");
+		isSucceeded &= ice::test::Expect(ice::test::ToString(messages) == ice::test::ToString(parallelMessages),
+										 "LexParallel produces the same diagnostics as Lex");
+	}
+
+	return isSucceeded ? 0 : 1;
+}
\ No newline at end of file
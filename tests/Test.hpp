@@ -0,0 +1,60 @@
+#pragma once
+
+#include <ice/Interner.hpp>
+#include <ice/Lexer.hpp>
+#include <ice/Message.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace ice::test {
+	inline bool Expect(bool condition, std::string_view description) {
+		if (!condition) {
+			std::cerr << "failed: " << description << '\n';
+		}
+		return condition;
+	}
+
+	inline std::string ToString(const Messages& messages) {
+		std::string result;
+		for (std::size_t i = 0; i < messages.Size(); ++i) {
+			messages.Append(result, messages[i]);
+			result.push_back('\n');
+		}
+		return result;
+	}
+
+	inline bool IsEqual(const TokenBuffer& lhs, const Interner& lhsInterner, const TokenBuffer& rhs, const Interner& rhsInterner) {
+		if (lhs.Size() != rhs.Size() || lhs.LineCount() != rhs.LineCount() || lhs.LineBegins() != rhs.LineBegins()) return false;
+
+		for (std::size_t i = 0; i < lhs.Size(); ++i) {
+			if (lhs.Type(i) != rhs.Type(i) || lhs.Offset(i) != rhs.Offset(i) || lhs.Word(i) != rhs.Word(i) || lhs.Line(i) != rhs.Line(i)) return false;
+			else if ((lhs.Atom(i) == NoAtom) != (rhs.Atom(i) == NoAtom)) return false;
+			else if (lhs.Atom(i) != NoAtom && lhsInterner.Spelling(lhs.Atom(i)) != rhsInterner.Spelling(rhs.Atom(i))) return false;
+		}
+		return true;
+	}
+
+	inline std::string GenerateSource(std::size_t size) {
+		static constexpr std::string_view lines[] = {
+			"var value = 0x1F + 0b101 * 3.5e2",
+			"func f(a, b) { return a << 2 >= b ** 2 }",
+			"name = \"\xEB\xB3\x80\xEC\x88\x98 \xE5\xA4\x89\xE6\x95\xB0\" + 'c'",
+			"x = !!y && ~~z[[0]] // comment",
+			"broken = 0b2 + \"unterminated",
+			"\xEB\xB3\x80\xEC\x88\x98 = \xE5\x80\xA4 + 1",
+			"",
+		};
+
+		std::string result;
+		result.reserve(size + 64);
+		for (std::size_t i = 0; result.size() < size; ++i) {
+			result.append(lines[i % std::size(lines)]);
+			result.push_back('\n');
+		}
+		return result;
+	}
+}
\ No newline at end of file
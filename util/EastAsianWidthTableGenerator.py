@@ -1,56 +1,89 @@
 import os
 import sys
-import urllib.request
-
-if not os.path.exists("{}/detail".format(sys.argv[1])):
-	os.mkdir("{}/detail".format(sys.argv[1]))
-elif os.path.exists("{}/detail/EastAsianWidthTable.txt".format(sys.argv[1])):
-	sys.exit(0)
-
-res = urllib.request.urlopen("http://www.unicode.org/Public/UCD/latest/ucd/EastAsianWidth.txt")
-
-if res.getcode() == 200:
-	string = res.read().decode("utf8")
-	stringLines = string.splitlines()
-
-	data = list()
-
-	for line in stringLines:
-		if len(line) == 0 or line[0] == '#':
-			continue
-
-		temp = line.split(' ')[0].split(';')
-
-		table = temp[0]
-		tableBegin = 0
-		tableEnd = 0
-
-		if ".." in table:
-			tableSplited = table.split("..")
-			tableBegin = int(tableSplited[0], 16)
-			tableEnd = int(tableSplited[1], 16)
-		else:
-			tableBegin = int(table, 16)
-			tableEnd = tableBegin
-
-		if temp[1] == 'W':
-			dataLen = len(data)
-			if dataLen != 0 and data[-1][1] == 'F':
-				data[-1] = ((data[-1][0][0], tableEnd), 'F')
-			else:
-				data.append(((tableBegin, tableEnd), 'F'))
-		else:
-			dataLen = len(data)
-			if dataLen != 0 and data[-1][1] == 'H':
-				data[-1] = ((data[-1][0][0], tableEnd), 'H')
-			else:
-				data.append(((tableBegin, tableEnd), 'H'))
-
-	file = open("{}/detail/EastAsianWidthTable.txt".format(sys.argv[1]), "w")
-	
-	for element in data:
-		file.write("{{ {{ {}, {} }}, '{}' }},\n".format(element[0][0], element[0][1], element[1]))
-
-	file.close()
-else:
-	sys.exit(1)
\ No newline at end of file
+
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+WORD_BITS = 64
+MAX_CODEPOINT = 0x10FFFF
+
+def parseRange(string):
+	if ".." in string:
+		begin, end = string.split("..")
+		return int(begin, 16), int(end, 16)
+	else:
+		codepoint = int(string, 16)
+		return codepoint, codepoint
+
+def parseTable(path):
+	widths = bytearray(MAX_CODEPOINT + 1)
+	missings = list()
+	entries = list()
+
+	with open(path, encoding="utf8") as file:
+		for line in file:
+			line = line.strip()
+			if line.startswith("# @missing:"):
+				missings.append(line[len("# @missing:"):])
+				continue
+
+			line = line.split('#', 1)[0].strip()
+			if len(line) != 0:
+				entries.append(line)
+
+	for entry in missings + entries:
+		fields = [field.strip() for field in entry.split(';')]
+		if len(fields) < 2:
+			raise ValueError("invalid entry '{}'".format(entry))
+
+		begin, end = parseRange(fields[0])
+		isFullWidth = 1 if fields[1] in ("W", "F") else 0
+		for codepoint in range(begin, end + 1):
+			widths[codepoint] = isFullWidth
+
+	return widths
+
+def createBlocks(widths):
+	blocks = list()
+	blockIndices = dict()
+	indices = list()
+
+	for blockBegin in range(0, MAX_CODEPOINT + 1, BLOCK_SIZE):
+		words = list()
+		for wordBegin in range(blockBegin, blockBegin + BLOCK_SIZE, WORD_BITS):
+			word = 0
+			for bit in range(WORD_BITS):
+				if wordBegin + bit <= MAX_CODEPOINT and widths[wordBegin + bit]:
+					word |= 1 << bit
+			words.append(word)
+
+		words = tuple(words)
+		if words not in blockIndices:
+			blockIndices[words] = len(blocks)
+			blocks.append(words)
+		indices.append(blockIndices[words])
+
+	if len(blocks) > 256:
+		raise ValueError("too many distinct blocks")
+
+	return indices, blocks
+
+if len(sys.argv) < 2:
+	sys.exit("usage: {} <source directory> [EastAsianWidth.txt]".format(sys.argv[0]))
+
+sourcePath = sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "EastAsianWidth.txt")
+outputDirectory = os.path.join(sys.argv[1], "detail")
+outputPath = os.path.join(outputDirectory, "EastAsianWidthTable.txt")
+
+indices, blocks = createBlocks(parseTable(sourcePath))
+
+os.makedirs(outputDirectory, exist_ok=True)
+with open(outputPath, "w") as file:
+	file.write("constexpr std::size_t s_EastAsianWidthBlockBits = {};\n".format(BLOCK_BITS))
+	file.write("constexpr std::uint8_t s_EastAsianWidthBlockIndices[] = {\n")
+	for i in range(0, len(indices), 32):
+		file.write("\t" + ", ".join(str(index) for index in indices[i:i + 32]) + ",\n")
+	file.write("};\n")
+	file.write("constexpr std::uint64_t s_EastAsianWidthBlocks[][{}] = {{\n".format(BLOCK_SIZE // WORD_BITS))
+	for block in blocks:
+		file.write("\t{ " + ", ".join("0x{:016X}".format(word) for word in block) + " },\n")
+	file.write("};\n")
\ No newline at end of file